@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include "Chip8Core/Chip8CPU.h"
+
+namespace
+{
+constexpr int PROGRAM_REPEAT = 64;
+
+/**
+ * CPU wired to its own components, like the unit test fixture.
+ */
+struct CPUHarness
+{
+    chip8core::Chip8Memory         memory;
+    chip8core::Chip8GraphicsBuffer graphics;
+    chip8core::Chip8InputBuffer    input;
+    chip8core::Chip8Timer          delayTimer;
+    chip8core::Chip8Timer          soundTimer;
+    chip8core::Chip8CPU            cpu;
+
+    CPUHarness() : cpu(memory, graphics, input, delayTimer, soundTimer) {}
+
+    // Fills the program area with an opcode repeated, followed by a jump back to the start
+    void loadRepeated(uint16_t opcode)
+    {
+        uint16_t address = 0x200;
+        for (int i = 0; i < PROGRAM_REPEAT; ++i, address += 2)
+        {
+            memory.write(address, opcode >> 8);
+            memory.write(address + 1, opcode & 0xFF);
+        }
+        memory.write(address, 0x12);
+        memory.write(address + 1, 0x00);
+    }
+};
+
+void runCycles(benchmark::State& state, CPUHarness& harness)
+{
+    for (auto _ : state)
+    {
+        for (int i = 0; i <= PROGRAM_REPEAT; ++i)
+        {
+            harness.cpu.cycle();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (PROGRAM_REPEAT + 1));
+}
+
+void BM_Dispatch(benchmark::State& state, uint16_t opcode)
+{
+    CPUHarness harness;
+    harness.loadRepeated(opcode);
+    harness.cpu.setI(0x300);
+    runCycles(state, harness);
+}
+
+// One representative opcode per dispatch path and handler class
+BENCHMARK_CAPTURE(BM_Dispatch, 00E0_clear, 0x00E0);
+BENCHMARK_CAPTURE(BM_Dispatch, 3XKK_skip, 0x3001);
+BENCHMARK_CAPTURE(BM_Dispatch, 6XKK_load, 0x6A42);
+BENCHMARK_CAPTURE(BM_Dispatch, 7XKK_add, 0x7A01);
+BENCHMARK_CAPTURE(BM_Dispatch, 8XY4_alu, 0x8AB4);
+BENCHMARK_CAPTURE(BM_Dispatch, 8XYE_shift, 0x8ABE);
+BENCHMARK_CAPTURE(BM_Dispatch, ANNN_index, 0xA300);
+BENCHMARK_CAPTURE(BM_Dispatch, CXKK_random, 0xC0FF);
+BENCHMARK_CAPTURE(BM_Dispatch, EX9E_key, 0xE09E);
+BENCHMARK_CAPTURE(BM_Dispatch, FX07_timer, 0xF007);
+BENCHMARK_CAPTURE(BM_Dispatch, FX1E_addI, 0xF01E);
+BENCHMARK_CAPTURE(BM_Dispatch, FX33_bcd, 0xF033);
+BENCHMARK_CAPTURE(BM_Dispatch, FX55_store, 0xFF55);
+BENCHMARK_CAPTURE(BM_Dispatch, FX65_load, 0xFF65);
+
+void BM_CallReturn(benchmark::State& state)
+{
+    CPUHarness harness;
+    harness.memory.write(0x200, 0x22); // CALL 0x204
+    harness.memory.write(0x201, 0x04);
+    harness.memory.write(0x202, 0x12); // JP 0x200
+    harness.memory.write(0x203, 0x00);
+    harness.memory.write(0x204, 0x00); // RET
+    harness.memory.write(0x205, 0xEE);
+    for (auto _ : state)
+    {
+        harness.cpu.cycle();
+        harness.cpu.cycle();
+        harness.cpu.cycle();
+    }
+    state.SetItemsProcessed(state.iterations() * 3);
+}
+BENCHMARK(BM_CallReturn);
+
+/**
+ * DXYN with V0/V1 as coordinates. Args: sprite height, x, y.
+ */
+void BM_DrawSprite(benchmark::State& state)
+{
+    CPUHarness harness;
+    uint8_t    height = static_cast<uint8_t>(state.range(0));
+    harness.loadRepeated(0xD010 | height);
+    harness.cpu.setV(0, static_cast<uint8_t>(state.range(1)));
+    harness.cpu.setV(1, static_cast<uint8_t>(state.range(2)));
+    harness.cpu.setI(0x300);
+    for (int i = 0; i < 15; ++i)
+    {
+        harness.memory.write(0x300 + i, 0xA5);
+    }
+    runCycles(state, harness);
+}
+BENCHMARK(BM_DrawSprite)
+    ->ArgNames({"height", "x", "y"})
+    ->Args({1, 8, 8})
+    ->Args({5, 8, 8})
+    ->Args({15, 8, 8})
+    ->Args({15, 3, 8})   // Unaligned
+    ->Args({15, 60, 8})  // Horizontal wrap
+    ->Args({15, 8, 28})  // Vertical wrap
+    ->Args({15, 60, 28}); // Both
+} // namespace
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include "Chip8Core/Chip8GraphicsBuffer.h"
+
+namespace
+{
+void BM_GraphicsClear(benchmark::State& state)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    for (auto _ : state)
+    {
+        graphics.clear();
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_GraphicsClear);
+
+void BM_GraphicsDump(benchmark::State& state)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    graphics.setPixel(10, 10, true);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graphics.dumpFrameBuffer());
+    }
+}
+BENCHMARK(BM_GraphicsDump);
+
+void BM_GraphicsGetPixel(benchmark::State& state)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    for (auto _ : state)
+    {
+        for (int y = 0; y < chip8core::Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT; ++y)
+        {
+            for (int x = 0; x < chip8core::Chip8GraphicsBuffer::FRAMEBUFFER_WIDTH; ++x)
+            {
+                benchmark::DoNotOptimize(graphics.getPixel(x, y));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 64 * 32);
+}
+BENCHMARK(BM_GraphicsGetPixel);
+
+// Drawing keeps the frame hash current, so this includes its upkeep
+void BM_GraphicsDrawSpriteRow(benchmark::State& state)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    int                            y = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graphics.drawSpriteRow(y * 7, y, 0xA5));
+        y = (y + 1) & 31;
+    }
+}
+BENCHMARK(BM_GraphicsDrawSpriteRow);
+
+// Comparing frames by hash instead of dumpFrameBuffer() vectors
+void BM_GraphicsHashCompare(benchmark::State& state)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    graphics.setPixel(10, 10, true);
+    uint64_t previous = graphics.getHash();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graphics.isSameFrame(previous));
+    }
+}
+BENCHMARK(BM_GraphicsHashCompare);
+
+void BM_GraphicsHashRows(benchmark::State& state)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    graphics.setPixel(10, 10, true);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(chip8core::Chip8GraphicsBuffer::hashRows(graphics.data()));
+    }
+}
+BENCHMARK(BM_GraphicsHashRows);
+} // namespace
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "Chip8Core/Chip8Memory.h"
+
+namespace
+{
+void BM_MemoryRead(benchmark::State& state)
+{
+    chip8core::Chip8Memory memory;
+    uint16_t               address = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(memory.read(address));
+        address = (address + 1) & 0xFFF;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MemoryRead);
+
+void BM_MemoryWrite(benchmark::State& state)
+{
+    chip8core::Chip8Memory memory;
+    uint16_t               address = 0;
+    for (auto _ : state)
+    {
+        memory.write(address, static_cast<uint8_t>(address));
+        address = (address + 1) & 0xFFF;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MemoryWrite);
+
+void BM_MemoryBlockRead(benchmark::State& state)
+{
+    chip8core::Chip8Memory memory;
+    size_t                 length = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(memory.read(0x200, length));
+    }
+    state.SetBytesProcessed(state.iterations() * length);
+}
+BENCHMARK(BM_MemoryBlockRead)->Arg(16)->Arg(256)->Arg(3584);
+
+void BM_MemoryBlockWrite(benchmark::State& state)
+{
+    chip8core::Chip8Memory memory;
+    std::vector<uint8_t>   data(static_cast<size_t>(state.range(0)), 0xAB);
+    for (auto _ : state)
+    {
+        memory.write(0x200, data);
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_MemoryBlockWrite)->Arg(16)->Arg(256)->Arg(3584);
+} // namespace
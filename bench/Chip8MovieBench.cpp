@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "Chip8Core/Chip8Movie.h"
+
+namespace
+{
+constexpr uint64_t SESSION_CYCLES = 60 * 700; // One emulated minute at 700Hz
+
+std::vector<uint8_t> readROM(const char* name)
+{
+    std::ifstream file(std::filesystem::path(CHIP8_ROM_DIR) / name, std::ios::binary);
+    return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)),
+                                std::istreambuf_iterator<char>());
+}
+
+/**
+ * Builds a gameplay session for Space Invaders: move left and right under
+ * fire, changing keys a few times a second. Replaying roms/invaders.c8m
+ * instead would benchmark a recorded human session.
+ */
+chip8core::Chip8Movie makeInvadersSession()
+{
+    chip8core::Chip8Movie movie;
+    movie.seed   = 1;
+    movie.length = SESSION_CYCLES;
+
+    const uint16_t keys[] = {1 << 5, 1 << 4 | 1 << 5, 1 << 4, 0, 1 << 6 | 1 << 5, 1 << 6};
+    for (uint64_t cycle = 700, i = 0; cycle < SESSION_CYCLES; cycle += 150 + (i * 37) % 200, ++i)
+    {
+        movie.events.push_back({cycle, keys[i % 6]});
+    }
+    return movie;
+}
+
+/**
+ * Replays an input movie at full headless speed and reports emulated MIPS.
+ */
+void BM_MoviePlayback(benchmark::State& state)
+{
+    spdlog::set_level(spdlog::level::off);
+
+    std::vector<uint8_t>  rom = readROM("invaders.ch8");
+    chip8core::Chip8Movie movie;
+    std::ifstream         recorded(std::filesystem::path(CHIP8_ROM_DIR) / "invaders.c8m");
+    movie = recorded ? chip8core::Chip8Movie::read(recorded) : makeInvadersSession();
+
+    chip8core::Chip8            chip8;
+    chip8core::Chip8MoviePlayer player(movie);
+    int64_t                     cycles = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        player.start(chip8, rom.data(), rom.size());
+        state.ResumeTiming();
+
+        try
+        {
+            player.playToEnd(chip8);
+        }
+        catch (const std::exception& e)
+        {
+            state.SkipWithError(e.what());
+            break;
+        }
+        cycles += chip8.getCycleCount();
+    }
+    state.SetItemsProcessed(cycles);
+    state.counters["MIPS"] =
+        benchmark::Counter(static_cast<double>(cycles) / 1e6, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MoviePlayback)->Unit(benchmark::kMillisecond);
+} // namespace
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Chip8Core/Chip8.h"
+
+namespace
+{
+constexpr int CYCLES_PER_FRAME = 10;
+constexpr int FRAMES_PER_RUN   = 600; // 10 emulated seconds at the default speed
+
+/**
+ * Runs a ROM from reset for a fixed cycle budget and reports emulated MIPS.
+ */
+void BM_ROM(benchmark::State& state, const std::vector<uint8_t>& rom)
+{
+    chip8core::Chip8 chip8;
+    int64_t          cycles = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        chip8.setSeed(1);
+        chip8.reset();
+        chip8.loadROM(rom.data(), rom.size());
+        state.ResumeTiming();
+
+        try
+        {
+            for (int frame = 0; frame < FRAMES_PER_RUN; ++frame)
+            {
+                chip8.runFrame(CYCLES_PER_FRAME);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            state.SkipWithError(e.what());
+            break;
+        }
+        cycles += FRAMES_PER_RUN * CYCLES_PER_FRAME;
+    }
+    state.SetItemsProcessed(cycles);
+    state.counters["MIPS"] =
+        benchmark::Counter(static_cast<double>(cycles) / 1e6, benchmark::Counter::kIsRate);
+}
+
+// Registers one benchmark per bundled roms/*.ch8 file
+bool registerROMBenchmarks()
+{
+    // Invalid opcodes in some ROMs would otherwise log on every cycle
+    spdlog::set_level(spdlog::level::off);
+
+    std::vector<std::filesystem::path> paths;
+    std::error_code                    error;
+    for (const auto& entry : std::filesystem::directory_iterator(CHIP8_ROM_DIR, error))
+    {
+        if (entry.path().extension() == ".ch8")
+        {
+            paths.push_back(entry.path());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+
+    for (const auto& path : paths)
+    {
+        std::ifstream        file(path, std::ios::binary);
+        std::vector<uint8_t> rom((std::istreambuf_iterator<char>(file)),
+                                 std::istreambuf_iterator<char>());
+        benchmark::RegisterBenchmark(("BM_ROM/" + path.stem().string()).c_str(),
+                                     [rom](benchmark::State& state) { BM_ROM(state, rom); })
+            ->Unit(benchmark::kMillisecond);
+    }
+    return true;
+}
+
+const bool romBenchmarksRegistered = registerROMBenchmarks();
+} // namespace
@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "Chip8Core/Chip8SoundRenderer.h"
+
+namespace
+{
+constexpr int    SAMPLE_RATE = 44100;
+constexpr size_t BLOCK       = 512; // Samples per SDL audio callback
+
+// One callback block of steady tone, the worst case for the old per-sample loop
+void BM_SoundRenderTone(benchmark::State& state)
+{
+    chip8core::Chip8SoundRenderer renderer(SAMPLE_RATE);
+    std::vector<uint8_t>          block(BLOCK);
+    renderer.getQueue().push({0, true, 0, false, {}});
+
+    uint64_t played = 0;
+    for (auto _ : state)
+    {
+        played += BLOCK;
+        renderer.setEmulatedCycle(chip8core::Chip8SoundRenderer::LATENCY_CYCLES +
+                                  played * 700 / SAMPLE_RATE);
+        renderer.render(block.data(), block.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BLOCK);
+}
+BENCHMARK(BM_SoundRenderTone);
+
+// Blocks cut by an edge every few hundred samples, as in rapid sound effects
+void BM_SoundRenderEdges(benchmark::State& state)
+{
+    chip8core::Chip8SoundRenderer renderer(SAMPLE_RATE);
+    std::vector<uint8_t>          block(BLOCK);
+
+    uint64_t played = 0;
+    uint64_t edge   = 0;
+    bool     on     = false;
+    for (auto _ : state)
+    {
+        played += BLOCK;
+        uint64_t cycle = played * 700 / SAMPLE_RATE;
+        for (; edge < cycle; edge += 4)
+        {
+            on = !on;
+            renderer.getQueue().push({edge, on, 0, false, {}});
+        }
+        renderer.setEmulatedCycle(chip8core::Chip8SoundRenderer::LATENCY_CYCLES + cycle);
+        renderer.render(block.data(), block.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BLOCK);
+}
+BENCHMARK(BM_SoundRenderEdges);
+} // namespace
@@ -5,27 +5,174 @@
 #include "Chip8Core/Chip8CPU.h"
 #include "Chip8Core/Chip8GraphicsBuffer.h"
 #include "Chip8Core/Chip8InputBuffer.h"
+#include "Chip8Core/Chip8InputQueue.h"
 #include "Chip8Core/Chip8Memory.h"
+#include "Chip8Core/Chip8SoundRenderer.h"
+#include "Chip8Core/Chip8Stats.h"
 #include "Chip8Core/Chip8Timer.h"
 
 namespace chip8core
 {
 class Chip8
 {
-    static constexpr double CPU_CYCLE_TIME   = 1.0 / 700.0; // 700Hz
-    static constexpr double TIMER_CYCLE_TIME = 1.0 / 60.0;  // 60Hz
+    static constexpr double   MAX_LAG_TIME       = 0.25;    // Emulated time kept after a stall
+    static constexpr uint64_t MAX_LAG_CYCLES     = 175;     // MAX_LAG_TIME at 700Hz
+    static constexpr uint64_t UNLIMITED_SLICE_NS = 8000000; // Host time per unlimited cycle()
 
   public:
+    static constexpr int    CPU_HZ          = 700; // Default CPU rate, and the unit of the clock
+    static constexpr int    TIMER_HZ        = 60;
+    static constexpr int    CATCH_UP_BUDGET = 36; // Most cycles one cycle() call runs at 700Hz
+    static constexpr double UNLIMITED       = 0.0; // setSpeed() value for as fast as possible
+
     Chip8();
     ~Chip8();
     void reset();
     void loadROM(const uint8_t* romData, size_t romSize);
-    void cycle();
+
+    /**
+     * @brief Runs the CPU and timers for the wall-clock time since the last call.
+     *
+     * Wall time is scaled by getSpeed() and run at getCpuHz(). A call runs
+     * at most three timer ticks' worth, CATCH_UP_BUDGET cycles at the default
+     * rate, so time owed after a slow host frame is caught up over the next
+     * few calls instead of in one burst. After a stall longer than
+     * MAX_LAG_TIME the excess is dropped and counted in Chip8Stats::cyclesDropped.
+     * At UNLIMITED speed a call instead runs whole frames for about 8ms of
+     * host time, with the timers still ticking every getCpuHz() / 60 cycles.
+     * @return The number of instructions executed.
+     */
+    int cycle();
+
+    /**
+     * @brief Sets the emulated CPU rate. Takes effect at once and survives reset().
+     *
+     * The timers keep ticking at 60Hz of emulated time, so this sets how many
+     * instructions run per frame. Movies replay only at the rate they were
+     * recorded at.
+     * @param hz Instructions per emulated second, at least TIMER_HZ.
+     */
+    void setCpuHz(int hz);
+    int  getCpuHz() const { return cpuHz_; }
+
+    /**
+     * @brief Sets the instructions per 60Hz frame, i.e. setCpuHz(cycles * TIMER_HZ).
+     */
+    void setCyclesPerFrame(int cycles) { setCpuHz(cycles * TIMER_HZ); }
+
+    /**
+     * @brief Sets how fast cycle() runs emulated time against wall time.
+     * @param speed 1 for real time, 4 for 4x turbo, or UNLIMITED for as fast as possible.
+     */
+    void   setSpeed(double speed);
+    double getSpeed() const { return speed_; }
+
+    /**
+     * @brief Runs the CPU and timers up to a time set by an outside clock, e.g. the audio device.
+     *
+     * Used instead of cycle() when the audio callback or a Chip8FramePacer
+     * paces the emulation, see Chip8SoundRenderer::getTargetCycle(). Queued
+     * key events are applied as in cycle(), and more than MAX_LAG_TIME behind
+     * is dropped. getSpeed() does not apply; the caller's clock decides.
+     * @param targetClock The getEmulatedClock() to reach; nothing runs if already past it.
+     * @return The number of instructions executed.
+     */
+    int cycleUntil(uint64_t targetClock);
+
+    /**
+     * @brief Runs a number of CPU cycles, ticking the timers on the emulated 60Hz clock.
+     *
+     * cycle() runs through here too, so a session depends only on the seed,
+     * the ROM and the cycle numbers at which keys change, never on wall time.
+     * @param count The number of CPU cycles to run.
+     */
+    void runCycles(uint64_t count);
+
+    /**
+     * @brief Runs a number of CPU cycles that end at a host time, applying queued key events.
+     *
+     * Cycle i of count is taken to run at endNs - (count - i) host cycle times,
+     * and each event from the attached queue is applied before the first cycle
+     * at or after its timestamp, at most one event per cycle so a press and
+     * release are never merged. Events after the last cycle stay queued.
+     * @param count The number of CPU cycles to run.
+     * @param endNs The host time, on the Chip8Stats::now() clock, at which they end.
+     */
+    void runCycles(uint64_t count, uint64_t endNs);
+
+    /**
+     * @brief Feeds cycle() with key events from a queue instead of direct key state writes.
+     * @param queue The queue, or nullptr to detach. Must outlive the attachment.
+     */
+    void attachInputQueue(Chip8InputQueue* queue) { inputQueue_ = queue; }
+
+    /**
+     * @brief Reports every keypad change applied from the input queue, e.g. to a recorder.
+     */
+    void setInputObserver(Chip8InputObserver* observer) { inputObserver_ = observer; }
+
+    /**
+     * @brief Pushes the buzzer state each time it changes, for a Chip8SoundRenderer.
+     *
+     * The current state is pushed right away, then an edge follows every time
+     * the sound timer starts or stops and every F002 or FX3A.
+     * @param queue The queue, or nullptr to detach. Must outlive the attachment.
+     */
+    void attachSoundQueue(Chip8SoundQueue* queue);
+
+    /**
+     * @brief Executes a single CPU instruction without touching the timers.
+     */
+    void step();
+
+    /**
+     * @brief Decrements the delay and sound timers by one 60Hz tick.
+     */
+    void updateTimers();
+
+    /**
+     * @brief Runs one emulated frame independent of wall-clock time.
+     * @param cyclesPerFrame The number of CPU cycles to run before the 60Hz timer tick.
+     */
+    void runFrame(int cyclesPerFrame);
+
+    /**
+     * @brief Seeds the CPU random generator, making CXKK reproducible.
+     */
+    void setSeed(uint32_t seed) { cpu_.setSeed(seed); }
+
+    /**
+     * @brief Gets the number of CPU cycles executed since the last reset.
+     */
+    uint64_t getCycleCount() const { return cycleCount_; }
+
+    /**
+     * @brief Gets the emulated time since the last reset, in cycles of the default 700Hz CPU.
+     *
+     * Follows the 60Hz timers rather than the instruction count, so it equals
+     * getCycleCount() at the default rate but keeps real time at any
+     * setCpuHz(). Sound edges and audio pacing use this clock. Includes the
+     * part of a CPU cycle that cycleUntil() was asked to reach but could not run.
+     */
+    uint64_t getEmulatedClock() const
+    {
+        return ((timerTicks_ * cpuHz_ + timerPhase_) * CPU_HZ + clockCarry_) /
+               (static_cast<uint64_t>(TIMER_HZ) * cpuHz_);
+    }
 
     const chip8core::Chip8GraphicsBuffer& getGraphics() const { return graphics_; }
     const chip8core::Chip8Timer&          getSoundTimer() const { return soundTimer_; }
+    const chip8core::Chip8Timer&          getDelayTimer() const { return delayTimer_; }
     chip8core::Chip8InputBuffer&          getInput() { return input_; }
+    const chip8core::Chip8InputBuffer&    getInput() const { return input_; }
     const chip8core::Chip8CPU&            getCPU() const { return cpu_; }
+    const chip8core::Chip8Memory&         getMemory() const { return memory_; }
+    chip8core::Chip8Stats&                getStats() { return stats_; }
+    const chip8core::Chip8Stats&          getStats() const { return stats_; }
+
+#ifdef CHIP8_PROFILING
+    chip8core::Chip8Profiler& getProfiler() { return cpu_.getProfiler(); }
+#endif
 
   private:
     chip8core::Chip8Memory         memory_;
@@ -33,11 +180,28 @@ class Chip8
     chip8core::Chip8InputBuffer    input_;
     chip8core::Chip8Timer          delayTimer_;
     chip8core::Chip8Timer          soundTimer_;
-    chip8core::Chip8CPU            cpu_;
-    double                         cpuAccumulator_   = 0.0;
-    double                         timerAccumulator_ = 0.0;
+    uint64_t                       clockCarry_ = 0; // Part of a cycle cycleUntil() still owes
+    chip8core::Chip8CPU            cpu_;            // 64-byte aligned; the members above pad to it
+    double                         cpuAccumulator_ = 0.0;
+    uint64_t                       cycleCount_     = 0;
+    uint64_t                       timerTicks_     = 0;
+    int                            timerPhase_     = 0; // TIMER_HZ per cycle, a tick every cpuHz_
+    int                            cpuHz_          = CPU_HZ;
+    double                         speed_          = 1.0;
+    uint64_t                       hostCycleNs_    = 1000000000 / CPU_HZ; // Wall time per cycle
+    uint64_t                       catchUpCycles_  = 12; // Cycles per host frame, rounded up
+    chip8core::Chip8Stats          stats_;
+    Chip8InputQueue*               inputQueue_    = nullptr;
+    Chip8InputObserver*            inputObserver_ = nullptr;
+    Chip8SoundQueue*               soundQueue_    = nullptr;
+    bool                           soundOn_       = false; // Last edge pushed to soundQueue_
+    uint32_t                       soundVoice_    = 0;     // Chip8CPU::getAudioGeneration() of it
+
+    void trackSoundEdge();
+    void runTimed(uint64_t count, std::chrono::steady_clock::time_point now);
+    int  cycleUnlimited(std::chrono::steady_clock::time_point start);
+    void updateHostRate();
 
     std::chrono::steady_clock::time_point lastTick_ = std::chrono::steady_clock::now();
-    void                                  updateTimers();
 };
 } // namespace chip8core
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Chip8Core/Chip8GraphicsBuffer.h"
+#include "Chip8Core/Chip8Memory.h"
+#include "Chip8Core/Chip8Random.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief Runs N instances of the same ROM in lockstep.
+ *
+ * Machine state is stored structure-of-arrays: register Vx of every lane is
+ * contiguous, as are PC, I, SP, the timers and the key masks. When every lane
+ * is at the same PC with the same opcode, ALU, skip and load instructions are
+ * executed as one loop across lanes that the compiler vectorizes. Lanes that
+ * diverge, and instructions that touch memory or the framebuffer, fall back to
+ * a per-lane interpreter with the same semantics as Chip8CPU.
+ */
+class Chip8Batch
+{
+  public:
+    static constexpr uint16_t PROGRAM_START      = 0x200;
+    static constexpr uint16_t FONT_ADDRESS       = 0x50;
+    static constexpr size_t   AUDIO_PATTERN_SIZE = 16; // Chip8CPU::AUDIO_PATTERN_SIZE
+
+    /**
+     * @brief Constructs a batch of lanes, all reset with seed 1.
+     * @param lanes The number of machines in the batch.
+     */
+    explicit Chip8Batch(size_t lanes);
+
+    /**
+     * @brief Destroys the Chip8Batch instance.
+     */
+    ~Chip8Batch();
+
+    /**
+     * @brief Resets every lane. Lane i seeds its random generator with seed + i.
+     * @param seed The base random seed.
+     */
+    void reset(uint32_t seed = 1);
+
+    /**
+     * @brief Copies a ROM into the program area of every lane.
+     * @param romData Pointer to the ROM bytes.
+     * @param romSize Number of ROM bytes.
+     */
+    void loadROM(const uint8_t* romData, size_t romSize);
+
+    /**
+     * @brief Executes a single CPU cycle on every lane.
+     */
+    void step();
+
+    /**
+     * @brief Executes a frame: a number of CPU cycles followed by one 60Hz timer tick.
+     * @param cyclesPerFrame The number of CPU cycles to run.
+     */
+    void runFrame(int cyclesPerFrame);
+
+    /**
+     * @brief Decrements the delay and sound timers of every lane.
+     */
+    void updateTimers();
+
+    /**
+     * @brief Sets the keypad state of one lane. Bit k is set while key k is held.
+     */
+    void setKeys(size_t lane, uint16_t keyMask) { keys_[lane] = keyMask; }
+
+    size_t   size() const { return lanes_; }
+    uint16_t getPC(size_t lane) const { return PC_[lane]; }
+    uint16_t getI(size_t lane) const { return I_[lane]; }
+    uint8_t  getSP(size_t lane) const { return SP_[lane]; }
+    uint8_t  getV(size_t lane, size_t index) const { return V_[index * lanes_ + lane]; }
+    uint16_t getStack(size_t lane, size_t index) const { return stack_[index * lanes_ + lane]; }
+    uint8_t  getDelayTimer(size_t lane) const { return delayTimer_[lane]; }
+    uint8_t  getSoundTimer(size_t lane) const { return soundTimer_[lane]; }
+    uint16_t getKeys(size_t lane) const { return keys_[lane]; }
+    uint8_t  getPitch(size_t lane) const { return pitch_[lane]; }
+    bool     hasAudioPattern(size_t lane) const { return hasAudioPattern_[lane] != 0; }
+
+    /**
+     * @brief Gets the XO-CHIP audio pattern of a lane (Chip8CPU::AUDIO_PATTERN_SIZE bytes).
+     */
+    const uint8_t* getAudioPattern(size_t lane) const
+    {
+        return &audioPatterns_[lane * AUDIO_PATTERN_SIZE];
+    }
+
+    /**
+     * @brief Reads a byte of a lane's memory.
+     */
+    uint8_t readMemory(size_t lane, uint16_t address) const
+    {
+        return memory_[lane * Chip8Memory::MEMORY_SIZE + (address & ADDRESS_MASK)];
+    }
+
+    /**
+     * @brief Gets the memory of a lane (Chip8Memory::MEMORY_SIZE bytes).
+     */
+    const uint8_t* getMemory(size_t lane) const
+    {
+        return &memory_[lane * Chip8Memory::MEMORY_SIZE];
+    }
+
+    /**
+     * @brief Gets the packed framebuffer rows of a lane, laid out like Chip8GraphicsBuffer::data().
+     */
+    const uint64_t* getFrameBuffer(size_t lane) const
+    {
+        return &framebuffers_[lane * Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT];
+    }
+
+    /**
+     * @brief Number of steps executed across all lanes at once since the last reset.
+     */
+    uint64_t getUniformSteps() const { return uniformSteps_; }
+
+    /**
+     * @brief Number of steps that fell back to per-lane execution since the last reset.
+     */
+    uint64_t getDivergentSteps() const { return divergentSteps_; }
+
+  private:
+    static constexpr uint16_t ADDRESS_MASK = Chip8Memory::MEMORY_SIZE - 1;
+
+    size_t lanes_;
+
+    std::vector<uint8_t>     V_;     // [register][lane]
+    std::vector<uint16_t>    I_;     // [lane]
+    std::vector<uint16_t>    PC_;    // [lane]
+    std::vector<uint8_t>     SP_;    // [lane]
+    std::vector<uint16_t>    stack_; // [level][lane]
+    std::vector<uint8_t>     delayTimer_;
+    std::vector<uint8_t>     soundTimer_;
+    std::vector<uint16_t>    keys_;
+    std::vector<uint16_t>    prevKeys_;
+    std::vector<uint8_t>     pitch_;           // [lane], set by FX3A
+    std::vector<uint8_t>     hasAudioPattern_; // [lane], set by F002
+    std::vector<uint8_t>     audioPatterns_;   // [lane][byte]
+    std::vector<Chip8Random> random_;
+    std::vector<uint64_t>    framebuffers_; // [lane][row]
+    std::vector<uint8_t>     memory_;       // [lane][address]
+
+    uint64_t uniformSteps_   = 0;
+    uint64_t divergentSteps_ = 0;
+
+    uint16_t fetch(size_t lane) const;
+    bool     executeUniform(uint16_t opcode);
+    void     executeLane(size_t lane, uint16_t opcode);
+    void     drawSprite(size_t lane, uint16_t opcode);
+
+    uint8_t*  lanesOf(size_t reg) { return &V_[reg * lanes_]; }
+    uint8_t&  laneMemory(size_t lane, uint16_t address);
+    uint8_t&  reg(size_t lane, size_t index) { return V_[index * lanes_ + lane]; }
+    uint16_t& stackAt(size_t lane, size_t index) { return stack_[index * lanes_ + lane]; }
+};
+} // namespace chip8core
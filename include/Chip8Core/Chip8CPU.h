@@ -4,14 +4,54 @@
 #include "Chip8Core/Chip8GraphicsBuffer.h"
 #include "Chip8Core/Chip8InputBuffer.h"
 #include "Chip8Core/Chip8Memory.h"
+#include "Chip8Core/Chip8Random.h"
 #include "Chip8Core/Chip8Timer.h"
+
+#ifdef CHIP8_PROFILING
+#include "Chip8Core/Chip8Profiler.h"
+#endif
 namespace chip8core
 {
 
+/**
+ * @brief Addresses of the live CPU registers and stack, for zero-copy views such as JS arrays.
+ *
+ * The pointers stay valid, and follow every instruction, for the lifetime of the CPU.
+ */
+struct Chip8CPUStateView
+{
+    const uint8_t*  v;     // V0 to VF
+    const uint16_t* i;
+    const uint16_t* pc;
+    const uint8_t*  sp;
+    const uint16_t* stack; // 16 return addresses, see Chip8CPU::getStack()
+};
+
 class Chip8CPU
 {
   public:
-    static constexpr int FONT_BYTES = 5 * 16;
+    static constexpr int     FONT_BYTES         = 5 * 16;
+    static constexpr int     AUDIO_PATTERN_SIZE = 16; // XO-CHIP 1-bit samples, 128 per loop
+    static constexpr uint8_t DEFAULT_PITCH      = 64; // 4000 pattern bits per second
+
+    static constexpr uint8_t chip8Font[FONT_BYTES] = {
+        0xF0, 0x90, 0x90, 0x90, 0xF0, // 0
+        0x20, 0x60, 0x20, 0x20, 0x70, // 1
+        0xF0, 0x10, 0xF0, 0x80, 0xF0, // 2
+        0xF0, 0x10, 0xF0, 0x10, 0xF0, // 3
+        0x90, 0x90, 0xF0, 0x10, 0x10, // 4
+        0xF0, 0x80, 0xF0, 0x10, 0xF0, // 5
+        0xF0, 0x80, 0xF0, 0x90, 0xF0, // 6
+        0xF0, 0x10, 0x20, 0x40, 0x40, // 7
+        0xF0, 0x90, 0xF0, 0x90, 0xF0, // 8
+        0xF0, 0x90, 0xF0, 0x10, 0xF0, // 9
+        0xF0, 0x90, 0xF0, 0x90, 0x90, // A
+        0xE0, 0x90, 0xE0, 0x90, 0xE0, // B
+        0xF0, 0x80, 0x80, 0x80, 0xF0, // C
+        0xE0, 0x90, 0x90, 0x90, 0xE0, // D
+        0xF0, 0x80, 0xF0, 0x80, 0xF0, // E
+        0xF0, 0x80, 0xF0, 0x80, 0x80  // F
+    };
 
     /**
      * @brief Constructs a Chip8CPU instance.
@@ -47,6 +87,21 @@ class Chip8CPU
      */
     uint16_t getSP() const { return SP_; }
 
+    /**
+     * @brief Gets a return address from the call stack.
+     * @param index The stack level, 0 to 15. 2NNN pre-increments SP, so the
+     *              first call uses level 1, and the 16th wraps to level 0.
+     * @return The address execution resumes at after the matching 00EE.
+     */
+    uint16_t getStack(size_t index) const
+    {
+        if (index < 16)
+        {
+            return stack_[index];
+        }
+        throw std::out_of_range("Invalid stack index");
+    }
+
     /**
      * @brief Gets the current index register.
      */
@@ -54,6 +109,18 @@ class Chip8CPU
 
     void setI(uint16_t value) { I_ = value; }
 
+    /**
+     * @brief Sets the seed used by CXKK. It is reapplied on every reset.
+     * @param seed The random seed.
+     */
+    void setSeed(uint32_t seed)
+    {
+        seed_ = seed;
+        random_.setSeed(seed);
+    }
+
+    uint32_t getSeed() const { return seed_; }
+
     uint8_t getFont(size_t index) const
     {
         if (index < FONT_BYTES)
@@ -92,31 +159,70 @@ class Chip8CPU
         throw std::out_of_range("Invalid register index");
     }
 
+    /**
+     * @brief Gets the addresses of the registers and stack, to read them without copies.
+     */
+    Chip8CPUStateView getStateView() const { return {V_, &I_, &PC_, &SP_, stack_}; }
+
+    /**
+     * @brief Gets the XO-CHIP audio pattern loaded by F002.
+     */
+    const uint8_t* getAudioPattern() const { return audioPattern_; }
+
+    /**
+     * @brief Whether a ROM loaded an audio pattern since reset; if not the classic buzzer plays.
+     */
+    bool hasAudioPattern() const { return hasAudioPattern_; }
+
+    /**
+     * @brief Gets the XO-CHIP pitch register set by FX3A.
+     */
+    uint8_t getPitch() const { return pitch_; }
+
+    /**
+     * @brief Gets a counter bumped by every F002 and FX3A, to spot audio changes cheaply.
+     */
+    uint32_t getAudioGeneration() const { return audioGeneration_; }
+
+    /**
+     * @brief Gets the number of invalid or unimplemented opcodes executed since reset.
+     *
+     * Such opcodes are logged and skipped, so a ROM that ran off its code keeps
+     * going; headless runners use this to stop and report the fault instead.
+     */
+    uint32_t getInvalidOpcodeCount() const { return invalidOpcodes_; }
+
+    /**
+     * @brief Gets the address of the first invalid opcode since reset, if there was one.
+     */
+    uint16_t getFaultPC() const { return faultPC_; }
+
+#ifdef CHIP8_PROFILING
+    /**
+     * @brief Gets the execution profiler (only with CHIP8_PROFILING).
+     */
+    Chip8Profiler&       getProfiler() { return profiler_; }
+    const Chip8Profiler& getProfiler() const { return profiler_; }
+#endif
+
   private:
-    uint8_t  V_[16];     // General purpose registers
-    uint16_t I_;         // Index register
-    uint16_t PC_;        // Program counter
-    uint8_t  SP_;        // Stack pointer
-    uint16_t stack_[16]; // Stack for subroutine calls
+    // Hot register state is declared first and aligned so it shares a single cache line
+    alignas(64) uint8_t V_[16]; // General purpose registers
+    uint16_t I_;                // Index register
+    uint16_t PC_;               // Program counter
+    uint8_t  SP_;               // Stack pointer
+    uint16_t stack_[16];        // Stack for subroutine calls
 
-    uint8_t chip8Font[FONT_BYTES] = {
-        0xF0, 0x90, 0x90, 0x90, 0xF0, // 0
-        0x20, 0x60, 0x20, 0x20, 0x70, // 1
-        0xF0, 0x10, 0xF0, 0x80, 0xF0, // 2
-        0xF0, 0x10, 0xF0, 0x10, 0xF0, // 3
-        0x90, 0x90, 0xF0, 0x10, 0x10, // 4
-        0xF0, 0x80, 0xF0, 0x10, 0xF0, // 5
-        0xF0, 0x80, 0xF0, 0x90, 0xF0, // 6
-        0xF0, 0x10, 0x20, 0x40, 0x40, // 7
-        0xF0, 0x90, 0xF0, 0x90, 0xF0, // 8
-        0xF0, 0x90, 0xF0, 0x10, 0xF0, // 9
-        0xF0, 0x90, 0xF0, 0x90, 0x90, // A
-        0xE0, 0x90, 0xE0, 0x90, 0xE0, // B
-        0xF0, 0x80, 0x80, 0x80, 0xF0, // C
-        0xE0, 0x90, 0x90, 0x90, 0xE0, // D
-        0xF0, 0x80, 0xF0, 0x80, 0xF0, // E
-        0xF0, 0x80, 0xF0, 0x80, 0x80  // F
-    };
+    uint32_t    seed_;
+    Chip8Random random_;
+
+    uint8_t  audioPattern_[AUDIO_PATTERN_SIZE];
+    bool     hasAudioPattern_;
+    uint8_t  pitch_;
+    uint32_t audioGeneration_ = 0;
+
+    uint32_t invalidOpcodes_ = 0;
+    uint16_t faultPC_        = 0;
 
     Chip8Memory&         memory_;
     Chip8GraphicsBuffer& graphics_;
@@ -124,17 +230,29 @@ class Chip8CPU
     Chip8Timer&          delayTimer_;
     Chip8Timer&          soundTimer_;
 
+#ifdef CHIP8_PROFILING
+    Chip8Profiler profiler_;
+#endif
+
     using OpcodeHandler = void (Chip8CPU::*)(uint16_t);
 
-    std::array<OpcodeHandler, 16>   main_opcode_table_;
-    std::array<OpcodeHandler, 16>   _0_table;
-    std::array<OpcodeHandler, 16>   _8_table;
-    std::array<OpcodeHandler, 16>   _E_table;
-    std::array<OpcodeHandler, 0x66> _F_table;
+    /**
+     * @brief Dispatch tables shared by every CPU instance.
+     */
+    struct OpcodeTables
+    {
+        std::array<OpcodeHandler, 16>   main_opcode_table_;
+        std::array<OpcodeHandler, 16>   _0_table;
+        std::array<OpcodeHandler, 16>   _8_table;
+        std::array<OpcodeHandler, 16>   _E_table;
+        std::array<OpcodeHandler, 0x66> _F_table;
+    };
+
+    static const OpcodeTables     opcodeTables_;
+    static constexpr OpcodeTables initializeOpcodeTables();
 
     void decodeOpcode(uint16_t opcode);
     void invalidOpcode(uint16_t opcode);
-    void initializeOpcodeTables();
     void loadFont();
 
     static uint8_t getNibble(uint16_t opcode, int nibbleIndex);
@@ -169,6 +287,7 @@ class Chip8CPU
     void opcode_DXYN(uint16_t opcode);
     void opcode_EXA1(uint16_t opcode);
     void opcode_EX9E(uint16_t opcode);
+    void opcode_F002(uint16_t opcode);
     void opcode_FX07(uint16_t opcode);
     void opcode_FX0A(uint16_t opcode);
     void opcode_FX15(uint16_t opcode);
@@ -176,6 +295,7 @@ class Chip8CPU
     void opcode_FX1E(uint16_t opcode);
     void opcode_FX29(uint16_t opcode);
     void opcode_FX33(uint16_t opcode);
+    void opcode_FX3A(uint16_t opcode);
     void opcode_FX55(uint16_t opcode);
     void opcode_FX65(uint16_t opcode);
 };
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace chip8core
+{
+
+/**
+ * @brief Formats CHIP-8 opcodes as Cowgod-style assembly, e.g. "DRW V0, V1, 5".
+ *
+ * Opcodes Chip8CPU does not implement are shown as data words ("DW 0x1234").
+ */
+class Chip8Disassembler
+{
+  public:
+    /**
+     * @brief Disassembles a single opcode.
+     */
+    static std::string disassemble(uint16_t opcode);
+
+    /**
+     * @brief Formats the instruction at an address as "0x200: 00E0  CLS".
+     * @param memory The machine memory (Chip8Memory::MEMORY_SIZE bytes).
+     * @param address The address of the instruction; it wraps at the end of memory.
+     */
+    static std::string disassembleAt(const uint8_t* memory, uint16_t address);
+};
+} // namespace chip8core
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "Chip8Core/Chip8.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief What an agent sees after Chip8Environment::reset or step.
+ */
+struct Chip8Observation
+{
+    uint64_t framebuffer[Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT]; // Packed rows, bit 63 is x = 0
+    bool     soundOn;
+    float    reward;
+};
+
+/**
+ * @brief User-defined reward, read from the machine's memory and registers after each step.
+ */
+using Chip8RewardProbe = std::function<float(const Chip8&)>;
+
+/**
+ * @brief Headless step/observe wrapper around Chip8 for batch agents.
+ *
+ * Runs a fixed ROM with deterministic frame stepping and no SDL dependency.
+ * Input is applied as a single 16-bit key mask per step and the observation
+ * is written into a reused buffer, so stepping does not allocate.
+ */
+class Chip8Environment
+{
+  public:
+    /**
+     * @brief Constructs an environment for a ROM.
+     * @param rom The ROM bytes, copied into the environment.
+     * @param cyclesPerFrame The number of CPU cycles per 60Hz frame.
+     */
+    explicit Chip8Environment(std::vector<uint8_t> rom, int cyclesPerFrame = 10);
+
+    /**
+     * @brief Sets the reward probe. Without one the reward is always 0.
+     */
+    void setRewardProbe(Chip8RewardProbe probe) { rewardProbe_ = std::move(probe); }
+
+    /**
+     * @brief Restarts the ROM with a new random seed.
+     * @param seed The seed for CXKK.
+     * @return The initial observation.
+     */
+    const Chip8Observation& reset(uint32_t seed);
+
+    /**
+     * @brief Holds a set of keys for a number of frames.
+     * @param keyMask Bit k is set while key k is held.
+     * @param frames The number of frames to run.
+     * @return The observation after the last frame.
+     */
+    const Chip8Observation& step(uint16_t keyMask, int frames = 1);
+
+    const Chip8&            getMachine() const { return machine_; }
+    const Chip8Observation& getObservation() const { return observation_; }
+
+  private:
+    std::vector<uint8_t> rom_;
+    int                  cyclesPerFrame_;
+    Chip8                machine_;
+    Chip8RewardProbe     rewardProbe_;
+    Chip8Observation     observation_;
+
+    void observe();
+};
+} // namespace chip8core
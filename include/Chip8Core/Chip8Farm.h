@@ -0,0 +1,95 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Chip8Core/Chip8InputScript.h"
+#include "Chip8Core/Chip8Movie.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief One ROM run of a regression farm.
+ */
+struct Chip8FarmJob
+{
+    std::string          name; // Key of the golden hashes, usually the ROM file name
+    std::vector<uint8_t> rom;
+    Chip8InputScript     input;
+    Chip8Movie           movie = {}; // Replayed instead of input when it has a length
+};
+
+struct Chip8FarmOptions
+{
+    int      frames          = 600;
+    int      cyclesPerFrame  = 10;
+    int      checkpointEvery = 60; // Frames between framebuffer hashes
+    uint32_t seed            = 1;
+    size_t   threads         = 0; // 0 for one per hardware thread
+};
+
+/**
+ * @brief Framebuffer hashes of one run, one per checkpoint frame.
+ */
+struct Chip8FarmResult
+{
+    std::string           name;
+    std::vector<int>      frames;
+    std::vector<uint64_t> hashes;
+    std::string           error; // Why the run stopped early, if it faulted
+};
+
+using Chip8GoldenHashes = std::map<std::string, std::map<int, uint64_t>>;
+
+/**
+ * @brief Runs many ROMs headless in parallel and checks their frames against golden hashes.
+ *
+ * Each job runs on its own Chip8 from reset with the same seed, so results are
+ * deterministic and independent of the thread count. Jobs with a movie use its
+ * seed and CPU rate and run for its length instead, with a checkpoint frame
+ * every 60th of an emulated second. Workers take the next
+ * job from a shared counter, which keeps every core busy when ROMs differ in
+ * cost. Golden files hold one "name frame hash" line per checkpoint.
+ *
+ * A run stops at the first frame that executed an invalid opcode and reports
+ * it in Chip8FarmResult::error; its frames after that are never hashed.
+ */
+class Chip8Farm
+{
+  public:
+    explicit Chip8Farm(Chip8FarmOptions options = {});
+
+    /**
+     * @brief Runs every job.
+     * @return One result per job, in job order.
+     */
+    std::vector<Chip8FarmResult> run(const std::vector<Chip8FarmJob>& jobs) const;
+
+    /**
+     * @brief Runs a single job on the calling thread.
+     */
+    Chip8FarmResult runJob(const Chip8FarmJob& job) const;
+
+    static Chip8GoldenHashes readGolden(std::istream& in);
+
+    /**
+     * @brief Writes the hashes of every result that did not fault.
+     */
+    static void writeGolden(std::ostream& out, const std::vector<Chip8FarmResult>& results);
+
+    /**
+     * @brief Compares a result with its golden hashes.
+     * @return One message per mismatching or missing checkpoint; empty if the run matches.
+     */
+    static std::vector<std::string> compare(const Chip8FarmResult&   result,
+                                            const Chip8GoldenHashes& golden);
+
+  private:
+    Chip8FarmOptions options_;
+};
+} // namespace chip8core
@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Chip8Core/Chip8Batch.h"
+#include "Chip8Core/Chip8GraphicsBuffer.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief Layout of one exported frame.
+ */
+enum class Chip8FrameFormat
+{
+    Bytes,    // 32x64 uint8, one byte per pixel
+    BitPacked // 32x8 uint8, eight pixels per byte, most significant bit leftmost
+};
+
+struct Chip8FrameExportOptions
+{
+    Chip8FrameFormat format  = Chip8FrameFormat::Bytes;
+    int              stack   = 1;     // Number of most recent frames written per machine
+    bool             maxPool = false; // Combine each frame with the one before to remove flicker
+    uint8_t          pixelOn = 255;   // Byte value of a lit pixel in Bytes format
+};
+
+/**
+ * @brief Writes framebuffers of many machines into one caller-provided tensor.
+ *
+ * Frames are captured from packed framebuffer rows (Chip8GraphicsBuffer::data(),
+ * Chip8Batch::getFrameBuffer()) into a small per-machine history, then exported
+ * as an N x stack x frame buffer with the oldest frame first. Max-pooling ORs
+ * each frame with its predecessor, which removes the flicker CHIP-8 games get
+ * from erasing and redrawing sprites on alternate frames.
+ */
+class Chip8FrameExporter
+{
+  public:
+    static constexpr size_t ROW_COUNT = Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT;
+
+    /**
+     * @brief Constructs an exporter with an empty history.
+     * @param machines The number of machines exported per call.
+     * @param options The frame layout, stacking and pooling options.
+     */
+    explicit Chip8FrameExporter(size_t machines, Chip8FrameExportOptions options = {});
+
+    /**
+     * @brief Clears the frame history of every machine.
+     */
+    void reset();
+
+    /**
+     * @brief Records the latest frame of one machine.
+     * @param machine The machine index.
+     * @param rows The packed framebuffer rows.
+     */
+    void capture(size_t machine, const uint64_t* rows);
+
+    /**
+     * @brief Records the latest frame of one machine, reusing its maintained hash.
+     */
+    void capture(size_t machine, const Chip8GraphicsBuffer& graphics);
+
+    /**
+     * @brief Records the latest frame of every lane of a batch.
+     */
+    void capture(const Chip8Batch& batch);
+
+    /**
+     * @brief Checks whether a machine's latest frame equals the one captured before it.
+     *
+     * Streaming consumers can skip exporting and encoding such frames.
+     */
+    bool isRepeat(size_t machine) const;
+
+    /**
+     * @brief Gets the Chip8GraphicsBuffer hash of a captured frame.
+     * @param machine The machine index.
+     * @param age 0 for the latest frame, 1 for the one before, at most the stack depth.
+     */
+    uint64_t getFrameHash(size_t machine, size_t age = 0) const;
+
+    /**
+     * @brief Writes the stacked frames of all machines.
+     * @param out Destination of at least getOutputSize() bytes.
+     */
+    void exportTo(uint8_t* out) const;
+
+    /**
+     * @brief Number of bytes written by exportTo.
+     */
+    size_t getOutputSize() const { return machines_ * options_.stack * getFrameSize(); }
+
+    /**
+     * @brief Number of bytes of one exported frame.
+     */
+    size_t getFrameSize() const { return frameSize(options_.format); }
+
+    static size_t frameSize(Chip8FrameFormat format);
+
+    /**
+     * @brief Converts one packed framebuffer to the requested layout.
+     * @param rows The packed framebuffer rows.
+     * @param format The output layout.
+     * @param pixelOn Byte value of a lit pixel in Bytes format.
+     * @param out Destination of frameSize(format) bytes.
+     */
+    static void writeFrame(const uint64_t* rows, Chip8FrameFormat format, uint8_t pixelOn,
+                           uint8_t* out);
+
+  private:
+    size_t                  machines_;
+    Chip8FrameExportOptions options_;
+    size_t                  historyLength_; // stack + 1, so the previous frame is always kept
+    std::vector<uint64_t>   history_;       // [machine][slot][row], a ring per machine
+    std::vector<uint64_t>   hashes_;        // [machine][slot]
+    std::vector<size_t>     head_;          // Slot of the most recent frame per machine
+
+    size_t          historySlot(size_t machine, size_t age) const;
+    const uint64_t* historyFrame(size_t machine, size_t age) const;
+    void            capture(size_t machine, const uint64_t* rows, uint64_t hash);
+};
+} // namespace chip8core
@@ -0,0 +1,113 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Chip8Core/Chip8Stats.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief Paces emulated frames to the display refresh with a bounded catch-up.
+ *
+ * Each host frame the emulation asks beginFrame() how many CPU cycles to run:
+ * one refresh period's worth, plus any whole periods it fell behind, up to
+ * MAX_CATCH_UP_FRAMES. Periods beyond that are dropped and reported in
+ * Chip8Stats::cyclesDropped, so a stall never turns into a burst that makes
+ * the timers jump. It then sleeps until the next deadline with
+ * sleepUntilDeadline(), which sleeps coarsely and yields only for the final
+ * SPIN_NS, instead of polling with short delays.
+ *
+ * Deadlines fall LEAD_NS before each vsync reported by onVsync(), so a frame
+ * is finished just in time to be presented. Fractions of a cycle carry over
+ * between frames, so the emulated clock keeps exact time at any refresh rate.
+ *
+ * Hosts called back once per vsync, like a browser's requestAnimationFrame,
+ * use beginFrameAt() with the callback's timestamp instead and never sleep.
+ */
+class Chip8FramePacer
+{
+  public:
+    static constexpr int      MAX_CATCH_UP_FRAMES = 2;
+    static constexpr uint64_t SPIN_NS             = 1000000;   // 1ms
+    static constexpr uint64_t LEAD_NS             = 2000000;   // 2ms
+    static constexpr size_t   REFRESH_WINDOW      = 8;         // Intervals the refresh rate uses
+    static constexpr uint64_t MAX_INTERVAL_NS     = 100000000; // Longer intervals are stalls
+
+    /**
+     * @param refreshHz The display refresh rate.
+     */
+    explicit Chip8FramePacer(double refreshHz = 60.0);
+
+    void     setRefreshRate(double refreshHz);
+    uint64_t getPeriodNs() const { return periodNs_; }
+
+    /**
+     * @brief Reports when a frame was presented, to align deadlines to vsync.
+     *
+     * Safe to call from the presentation thread while another thread paces.
+     * @param timestampNs When the present returned, on the Chip8Stats::now() clock.
+     */
+    void onVsync(uint64_t timestampNs) { vsyncNs_.store(timestampNs, std::memory_order_relaxed); }
+
+    /**
+     * @brief Starts a host frame and schedules the next deadline.
+     * @param nowNs The current time on the Chip8Stats::now() clock.
+     * @param stats Receives the cycles of any dropped frames.
+     * @return The number of CPU cycles to run this frame.
+     */
+    uint64_t beginFrame(uint64_t nowNs, Chip8Stats& stats);
+
+    /**
+     * @brief Starts a host frame at a vsync timestamp, e.g. requestAnimationFrame's.
+     *
+     * Owes the time since the previous timestamp, with the same catch-up cap
+     * and cycle carry as beginFrame(). The refresh period follows the median
+     * of the last REFRESH_WINDOW intervals, so 60, 120 and 144Hz displays all
+     * run one emulated second per second, and a display change is picked up
+     * within a few frames.
+     * @param timestampNs The vsync time, on any clock that only moves forward.
+     * @param stats Receives the cycles of any dropped frames.
+     * @return The number of CPU cycles to run; 0 for the first frame after pause().
+     */
+    uint64_t beginFrameAt(uint64_t timestampNs, Chip8Stats& stats);
+
+    /**
+     * @brief Stops owing time until the next beginFrameAt(), e.g. while a page is hidden.
+     */
+    void pause() { lastFrameNs_ = 0; }
+    bool isPaused() const { return lastFrameNs_ == 0; }
+
+    /**
+     * @brief Gets when the next frame should start.
+     */
+    uint64_t getDeadline() const { return deadline_; }
+
+    /**
+     * @brief Sleeps until getDeadline().
+     */
+    void sleepUntilDeadline() const { sleepUntil(deadline_); }
+
+    /**
+     * @brief Sleeps until a time on the Chip8Stats::now() clock, to within a few microseconds.
+     */
+    static void sleepUntil(uint64_t deadlineNs);
+
+    uint64_t getDroppedFrames() const { return droppedFrames_; }
+
+  private:
+    void     alignToVsync();
+    void     trackInterval(uint64_t intervalNs);
+    uint64_t takeCycles(uint64_t frameNs);
+
+    uint64_t              periodNs_                    = 0;
+    uint64_t              deadline_                    = 0; // 0 until the first frame
+    uint64_t              cycleFraction_               = 0; // Leftover cycles times 1e9
+    uint64_t              droppedFrames_               = 0;
+    uint64_t              lastFrameNs_                 = 0; // beginFrameAt() time, 0 when paused
+    uint64_t              intervalsNs_[REFRESH_WINDOW] = {};
+    size_t                intervalCount_               = 0;
+    std::atomic<uint64_t> vsyncNs_{0};
+};
+} // namespace chip8core
@@ -55,7 +55,51 @@ class Chip8GraphicsBuffer
 
     std::vector<uint32_t> dumpFrameBuffer() const;
 
+    /**
+     * XORs an 8-pixel sprite row into the framebuffer, wrapping horizontally.
+     * @param x The x-coordinate of the leftmost sprite pixel (taken modulo the width).
+     * @param y The row to draw into (taken modulo the height).
+     * @param sprite The sprite byte, most significant bit leftmost.
+     * @return True if any pixel was erased.
+     */
+    bool drawSpriteRow(int x, int y, uint8_t sprite);
+
+    /**
+     * Gets a packed framebuffer row. Pixel x is stored in bit (63 - x).
+     * @param y The row index.
+     * @return The 64 pixels of the row.
+     */
+    uint64_t getRow(int y) const { return rows_[y]; }
+
+    /**
+     * Gets the packed framebuffer rows (FRAMEBUFFER_HEIGHT entries).
+     */
+    const uint64_t* data() const { return rows_; }
+
+    /**
+     * Hashes packed framebuffer rows, e.g. for golden frame checks.
+     * Accepts data() as well as Chip8Batch::getFrameBuffer() and runner results.
+     * @param rows FRAMEBUFFER_HEIGHT packed rows.
+     * @return A 64-bit hash that is stable across platforms and builds.
+     */
+    static uint64_t hashRows(const uint64_t* rows);
+
+    /**
+     * Gets the hash of the current frame, equal to hashRows(data()).
+     * It is updated on every write, so reading it costs nothing.
+     */
+    uint64_t getHash() const { return hash_; }
+
+    /**
+     * Checks whether the frame is unchanged since a hash was taken with getHash().
+     * Lets frontends and recorders skip identical frames without comparing pixels.
+     */
+    bool isSameFrame(uint64_t hash) const { return hash_ == hash; }
+
   private:
-    uint32_t framebuffer_[FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT];
+    static_assert(FRAMEBUFFER_WIDTH == 64, "Rows are packed into 64-bit words");
+
+    uint64_t rows_[FRAMEBUFFER_HEIGHT];
+    uint64_t hash_; // XOR of the per-row hashes, updated as rows change
 };
 } // namespace chip8core
\ No newline at end of file
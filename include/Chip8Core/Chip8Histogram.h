@@ -0,0 +1,90 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace chip8core
+{
+
+/**
+ * @brief Fixed-width bucket histogram for timing values.
+ *
+ * Values at or beyond bucketWidth * bucketCount land in a final overflow
+ * bucket. Recording is a division and an increment, cheap enough to call
+ * every host frame.
+ */
+class Chip8Histogram
+{
+  public:
+    /**
+     * @brief Constructs an empty histogram.
+     * @param bucketWidth The range covered by each bucket, in the unit of the recorded values.
+     * @param bucketCount The number of regular buckets before the overflow bucket.
+     */
+    Chip8Histogram(uint64_t bucketWidth, size_t bucketCount)
+        : bucketWidth_(bucketWidth ? bucketWidth : 1), buckets_(bucketCount + 1)
+    {
+    }
+
+    void record(uint64_t value)
+    {
+        size_t bucket = static_cast<size_t>(
+            std::min<uint64_t>(value / bucketWidth_, buckets_.size() - 1));
+        ++buckets_[bucket];
+        ++count_;
+        sum_ += value;
+        max_ = std::max(max_, value);
+    }
+
+    void reset()
+    {
+        std::fill(buckets_.begin(), buckets_.end(), 0);
+        count_ = 0;
+        sum_   = 0;
+        max_   = 0;
+    }
+
+    /**
+     * @brief Estimates a percentile from the bucket counts.
+     * @param fraction The percentile as a fraction, e.g. 0.99.
+     * @return The upper bound of the bucket holding the percentile, or the
+     *         largest recorded value if it lies in the overflow bucket.
+     */
+    uint64_t percentile(double fraction) const
+    {
+        if (count_ == 0)
+        {
+            return 0;
+        }
+        uint64_t rank = static_cast<uint64_t>(fraction * (count_ - 1)) + 1;
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket + 1 < buckets_.size(); ++bucket)
+        {
+            seen += buckets_[bucket];
+            if (seen >= rank)
+            {
+                return std::min(max_, (bucket + 1) * bucketWidth_);
+            }
+        }
+        return max_;
+    }
+
+    uint64_t getCount() const { return count_; }
+    uint64_t getMax() const { return max_; }
+    uint64_t getMean() const { return count_ ? sum_ / count_ : 0; }
+    uint64_t getBucketWidth() const { return bucketWidth_; }
+
+    /**
+     * @brief Bucket counts; the last entry is the overflow bucket.
+     */
+    const std::vector<uint64_t>& getBuckets() const { return buckets_; }
+
+  private:
+    uint64_t              bucketWidth_;
+    std::vector<uint64_t> buckets_;
+    uint64_t              count_ = 0;
+    uint64_t              sum_   = 0;
+    uint64_t              max_   = 0;
+};
+} // namespace chip8core
@@ -3,19 +3,41 @@
 
 namespace chip8core
 {
+
+/**
+ * @brief The keypad state, stored as 16-bit masks with bit k set while key k is held.
+ *
+ * The previous mask is kept for one instruction so FX0A can detect releases
+ * as previous & ~current.
+ */
 class Chip8InputBuffer
 {
   public:
     Chip8InputBuffer();
     ~Chip8InputBuffer();
 
-    void syncKeyStates();
+    /**
+     * Ends the current instruction's view of key edges. A single 16-bit store.
+     */
+    void syncKeyStates() { previousKeys_ = keys_; }
+
     void setKeyState(uint8_t key, bool pressed);
     bool getKeyState(uint8_t key) const;
     bool wasKeyReleased(uint8_t key) const;
 
+    /**
+     * Gets the keys released since the last syncKeyStates(), as a mask.
+     */
+    uint16_t getReleasedKeys() const { return previousKeys_ & ~keys_; }
+
+    /**
+     * Sets all 16 keys at once. Bit k is set while key k is held.
+     */
+    void     setKeyMask(uint16_t mask) { keys_ = mask; }
+    uint16_t getKeyMask() const { return keys_; }
+
   private:
-    bool keyStates[16];
-    bool prevKeyStates[16];
+    uint16_t keys_         = 0;
+    uint16_t previousKeys_ = 0;
 };
-} // namespace chip8core
\ No newline at end of file
+} // namespace chip8core
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+
+#include "Chip8Core/Chip8SpscQueue.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief One key press or release as seen by the host.
+ */
+struct Chip8KeyEvent
+{
+    uint64_t timestampNs; // Host time of the transition on the Chip8Stats::now() clock
+    uint8_t  key;         // Chip8 key 0x0-0xF
+    bool     pressed;
+};
+
+/**
+ * @brief Receives every keypad change at the emulated cycle it takes effect.
+ */
+class Chip8InputObserver
+{
+  public:
+    virtual ~Chip8InputObserver() = default;
+
+    /**
+     * @param cycle Chip8::getCycleCount() when the change was applied.
+     * @param keyMask The new keypad state, bit k set while key k is held.
+     */
+    virtual void onKeysChanged(uint64_t cycle, uint16_t keyMask) = 0;
+};
+
+/**
+ * @brief Lock-free queue of key events from the frontend to the core.
+ *
+ * The frontend pushes every transition as it arrives, so taps shorter than a
+ * host frame are kept. Chip8::cycle() pops them and applies each at the
+ * emulated cycle matching its timestamp.
+ */
+using Chip8InputQueue = Chip8SpscQueue<Chip8KeyEvent, 256>;
+} // namespace chip8core
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace chip8core
+{
+
+/**
+ * @brief Keypad state applied from the start of a frame.
+ */
+struct Chip8InputEvent
+{
+    int      frame;
+    uint16_t keyMask;
+};
+
+/**
+ * @brief Scripted keypad input for headless runs, ordered by frame.
+ */
+using Chip8InputScript = std::vector<Chip8InputEvent>;
+
+/**
+ * @brief Reads a script of "frame keyMask" lines, e.g. "120 0x0010"; '#' starts a comment.
+ * @throws std::invalid_argument if a key mask is not a number.
+ */
+inline Chip8InputScript readInputScript(std::istream& in)
+{
+    Chip8InputScript script;
+    std::string      line;
+    while (std::getline(in, line))
+    {
+        std::istringstream fields(line.substr(0, line.find('#')));
+        int                frame;
+        std::string        mask;
+        if (fields >> frame >> mask)
+        {
+            script.push_back({frame, static_cast<uint16_t>(std::stoul(mask, nullptr, 0))});
+        }
+    }
+    return script;
+}
+} // namespace chip8core
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+
+#include "Chip8Core/Chip8GraphicsBuffer.h"
+#include "Chip8Core/Chip8Histogram.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief Measures input-to-photon latency at the framebuffer.
+ *
+ * Frontends report every key transition as they see it and every frame they
+ * draw. The time from the oldest unanswered transition to the first frame
+ * whose framebuffer hash differs from the previous one is recorded as one latency
+ * sample. Transitions that change nothing within TIMEOUT_NS, such as keys a
+ * ROM ignores, are counted as unanswered rather than skewing the histogram.
+ */
+class Chip8LatencyTracker
+{
+  public:
+    static constexpr uint64_t TIMEOUT_NS   = 1000000000; // 1s
+    static constexpr uint64_t BUCKET_NS    = 1000000;    // 1ms latency buckets
+    static constexpr size_t   BUCKET_COUNT = 250;
+
+    Chip8LatencyTracker();
+
+    /**
+     * @brief Clears the histogram and any pending transition.
+     */
+    void reset();
+
+    /**
+     * @brief Records a key press or release.
+     * @param timestampNs When the frontend saw the transition (Chip8Stats::now()).
+     */
+    void onKeyTransition(uint64_t timestampNs);
+
+    /**
+     * @brief Checks a drawn frame for the first change after a transition.
+     * @param graphics The framebuffer that was drawn.
+     * @param timestampNs When the frame was presented.
+     */
+    void onFrame(const Chip8GraphicsBuffer& graphics, uint64_t timestampNs);
+
+    const Chip8Histogram& getLatency() const { return latency_; }
+    uint64_t              getTransitionCount() const { return transitions_; }
+    uint64_t              getUnansweredCount() const { return unanswered_; }
+
+    /**
+     * @brief Writes the latency percentiles and transition counts as one line.
+     */
+    void dumpText(std::ostream& out) const;
+
+  private:
+    uint64_t       previousHash_ = 0; // Chip8GraphicsBuffer::getHash() of the last frame
+    uint64_t       pendingSince_ = 0;
+    bool           pending_      = false;
+    uint64_t       transitions_  = 0;
+    uint64_t       unanswered_   = 0;
+    Chip8Histogram latency_{BUCKET_NS, BUCKET_COUNT};
+};
+} // namespace chip8core
@@ -0,0 +1,183 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8Batch.h"
+#include "Chip8Core/Chip8InputScript.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief Complete architectural state of one machine, as compared by Chip8Lockstep.
+ */
+struct Chip8MachineState
+{
+    uint8_t  V[16];
+    uint16_t I;
+    uint16_t PC;
+    uint8_t  SP;
+    uint16_t stack[16];
+    uint8_t  delayTimer;
+    uint8_t  soundTimer;
+    uint8_t  pitch;           // XO-CHIP FX3A
+    bool     hasAudioPattern; // XO-CHIP F002 ran since reset
+    uint8_t  audioPattern[Chip8CPU::AUDIO_PATTERN_SIZE];
+    uint64_t framebuffer[Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT];
+    uint8_t  memory[Chip8Memory::MEMORY_SIZE];
+};
+
+/**
+ * @brief An execution engine that can be stepped one instruction at a time.
+ *
+ * Adapters wrap each interpreter (the reference Chip8CPU, Chip8Batch and any
+ * later cached, threaded or JIT engine) so Chip8Lockstep can drive them
+ * identically and compare their state.
+ */
+class Chip8Engine
+{
+  public:
+    virtual ~Chip8Engine() = default;
+
+    virtual const char* getName() const = 0;
+
+    /**
+     * @brief Resets the machine, seeds its random generator and loads a ROM.
+     */
+    virtual void reset(const std::vector<uint8_t>& rom, uint32_t seed) = 0;
+
+    /**
+     * @brief Sets the keypad state. Bit k is set while key k is held.
+     */
+    virtual void setKeys(uint16_t keyMask) = 0;
+
+    /**
+     * @brief Executes one instruction.
+     */
+    virtual void step() = 0;
+
+    /**
+     * @brief Performs one 60Hz timer tick.
+     */
+    virtual void updateTimers() = 0;
+
+    virtual uint16_t getPC() const                           = 0;
+    virtual void     capture(Chip8MachineState& state) const = 0;
+};
+
+/**
+ * @brief Chip8Engine over the reference Chip8 / Chip8CPU interpreter.
+ */
+class Chip8ReferenceEngine : public Chip8Engine
+{
+  public:
+    const char* getName() const override { return "reference"; }
+    void        reset(const std::vector<uint8_t>& rom, uint32_t seed) override;
+    void        setKeys(uint16_t keyMask) override { machine_.getInput().setKeyMask(keyMask); }
+    void        step() override { machine_.step(); }
+    void        updateTimers() override { machine_.updateTimers(); }
+    uint16_t    getPC() const override { return machine_.getCPU().getPC(); }
+    void        capture(Chip8MachineState& state) const override;
+
+  private:
+    Chip8 machine_;
+};
+
+/**
+ * @brief Chip8Engine over lane 0 of a Chip8Batch.
+ *
+ * With more than one lane the other lanes get different random seeds, so ROMs
+ * using CXKK also exercise the divergent per-lane path while lane 0 is checked.
+ */
+class Chip8BatchEngine : public Chip8Engine
+{
+  public:
+    explicit Chip8BatchEngine(size_t lanes = 1) : batch_(lanes) {}
+
+    const char* getName() const override { return "batch"; }
+    void        reset(const std::vector<uint8_t>& rom, uint32_t seed) override;
+    void        setKeys(uint16_t keyMask) override;
+    void        step() override { batch_.step(); }
+    void        updateTimers() override { batch_.updateTimers(); }
+    uint16_t    getPC() const override { return batch_.getPC(0); }
+    void        capture(Chip8MachineState& state) const override;
+
+  private:
+    Chip8Batch batch_;
+};
+
+enum class Chip8LockstepMode
+{
+    Instruction, // Compare after every instruction and every timer tick
+    Frame        // Compare after every timer tick only
+};
+
+struct Chip8LockstepOptions
+{
+    int               frames         = 600;
+    int               cyclesPerFrame = 10;
+    uint32_t          seed           = 1;
+    Chip8LockstepMode mode           = Chip8LockstepMode::Instruction;
+    Chip8InputScript  input;
+};
+
+/**
+ * @brief The first point at which two engines disagreed.
+ */
+struct Chip8Divergence
+{
+    bool        found        = false;
+    uint64_t    instructions = 0; // Instructions executed by each engine before detection
+    int         frame        = 0;
+    std::string field;            // e.g. "V3", "PC", "memory[0x2F0]" or "fault"
+    std::string report;           // Values, disassembled context and registers of both engines
+};
+
+/**
+ * @brief Runs a reference engine and a candidate engine side by side.
+ *
+ * Both engines get the same ROM, seed and scripted input. Execution stops at
+ * the first difference in any register, timer, stack entry, audio register,
+ * framebuffer row or memory byte, or when either engine throws.
+ */
+class Chip8Lockstep
+{
+  public:
+    static constexpr size_t HISTORY_LENGTH = 8;
+
+    Chip8Lockstep(Chip8Engine& reference, Chip8Engine& candidate);
+
+    /**
+     * @brief Runs both engines until they diverge or the frame budget is spent.
+     */
+    Chip8Divergence run(const std::vector<uint8_t>& rom, const Chip8LockstepOptions& options);
+
+    /**
+     * @brief Finds the first differing field of two states.
+     * @param detail If set, receives both values of the field, e.g. "0x04 vs 0x05".
+     * @return The field name, or an empty string if the states are equal.
+     */
+    static std::string compare(const Chip8MachineState& a, const Chip8MachineState& b,
+                               std::string* detail = nullptr);
+
+    /**
+     * @brief Builds input that taps every key in turn, pressing each for a few frames.
+     *
+     * Taps are spaced so FX0A sees both press and release and EX9E/EXA1 see both states.
+     */
+    static Chip8InputScript tapEveryKey(int frames, int period = 12, int holdFrames = 4);
+
+  private:
+    Chip8Engine&      reference_;
+    Chip8Engine&      candidate_;
+    Chip8MachineState referenceState_;
+    Chip8MachineState candidateState_;
+    uint16_t          history_[HISTORY_LENGTH]; // PCs of the last reference instructions
+    size_t            historyCount_ = 0;
+
+    void fail(Chip8Divergence& divergence, const std::string& field, const std::string& detail);
+};
+} // namespace chip8core
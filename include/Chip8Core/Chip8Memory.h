@@ -79,6 +79,11 @@ class Chip8Memory
      */
     std::vector<uint8_t> dump() const;
 
+    /**
+     * @brief Gets the raw memory contents (MEMORY_SIZE bytes) without copying.
+     */
+    const uint8_t* data() const { return memory_; }
+
   private:
     uint8_t memory_[MEMORY_SIZE];
 
@@ -0,0 +1,137 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Chip8Core/Chip8.h"
+
+namespace chip8core
+{
+
+/**
+ * Exception thrown when a movie file is malformed.
+ */
+class Chip8MovieError : public std::runtime_error
+{
+  public:
+    explicit Chip8MovieError(const std::string& message) : std::runtime_error(message) {}
+};
+
+/**
+ * @brief A keypad state change at an emulated cycle.
+ */
+struct Chip8MovieEvent
+{
+    uint64_t cycle;   // Chip8::getCycleCount() before which the keys change
+    uint16_t keyMask; // Bit k is set while key k is held
+};
+
+/**
+ * @brief A recorded session: the random seed plus every keypad change by cycle number.
+ *
+ * Keyed by emulated cycles rather than wall time, a movie replays the exact
+ * same session on any host at any speed. Files are binary: the "C8MV" magic,
+ * a version byte, the seed, the CPU rate, length and event count as varints,
+ * then each event as a varint cycle delta and a 16-bit little-endian key
+ * mask, so a typical key change costs three or four bytes. Version 1 files
+ * have no CPU rate and replay at Chip8::CPU_HZ.
+ */
+struct Chip8Movie
+{
+    static constexpr uint8_t VERSION = 2;
+
+    uint32_t                     seed   = 0;
+    uint32_t                     cpuHz  = Chip8::CPU_HZ; // Chip8::getCpuHz(); sets the timer ticks
+    uint64_t                     length = 0;             // Cycles the session ran for
+    std::vector<Chip8MovieEvent> events;
+
+    void              write(std::ostream& out) const;
+    static Chip8Movie read(std::istream& in);
+
+    /**
+     * @brief Writes the movie to a file.
+     * @return True on success.
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Reads a movie from a file, logging an error if it is missing or malformed.
+     * @return True on success.
+     */
+    bool load(const std::string& path);
+};
+
+/**
+ * @brief Records the keypad of a machine into a movie.
+ *
+ * Start recording right after reset. Key changes applied from an input queue
+ * are recorded at their exact cycle once the recorder is set as the machine's
+ * input observer; keys set directly are picked up by calling poll() after
+ * each change.
+ */
+class Chip8MovieRecorder : public Chip8InputObserver
+{
+  public:
+    /**
+     * @brief Starts a movie of a machine that was just reset and loaded.
+     */
+    explicit Chip8MovieRecorder(const Chip8& machine);
+
+    /**
+     * @brief Records the current key mask if it changed since the last poll.
+     */
+    void poll(Chip8& machine);
+
+    void onKeysChanged(uint64_t cycle, uint16_t keyMask) override;
+
+    /**
+     * @brief Ends the movie at the machine's current cycle.
+     */
+    const Chip8Movie& finish(const Chip8& machine);
+
+    const Chip8Movie& getMovie() const { return movie_; }
+
+  private:
+    Chip8Movie movie_;
+    uint16_t   keyMask_ = 0;
+};
+
+/**
+ * @brief Replays a movie into a machine as fast as the host allows.
+ */
+class Chip8MoviePlayer
+{
+  public:
+    explicit Chip8MoviePlayer(const Chip8Movie& movie) : movie_(movie) {}
+
+    /**
+     * @brief Seeds and resets the machine at the movie's CPU rate, loads the ROM and rewinds.
+     */
+    void start(Chip8& machine, const uint8_t* romData, size_t romSize);
+
+    /**
+     * @brief Runs up to a number of cycles, applying key changes at their recorded cycles.
+     * Stops early at the end of the movie.
+     * @return The number of cycles run.
+     */
+    uint64_t advance(Chip8& machine, uint64_t cycles);
+
+    /**
+     * @brief Runs the rest of the movie.
+     */
+    void playToEnd(Chip8& machine) { advance(machine, movie_.length); }
+
+    bool isFinished(const Chip8& machine) const
+    {
+        return machine.getCycleCount() >= movie_.length;
+    }
+
+  private:
+    const Chip8Movie& movie_;
+    size_t            nextEvent_ = 0;
+};
+} // namespace chip8core
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace chip8core
+{
+
+/**
+ * @brief Execution histogram and sampled handler timing for Chip8CPU.
+ *
+ * Counts executions per opcode class and per program counter, and every
+ * sampleInterval instructions measures the host time spent in the handler.
+ * Timing uses the TSC on x86-64 and std::chrono::steady_clock elsewhere; the
+ * unit is reported by getTimeUnit().
+ *
+ * Chip8CPU only records into a profiler when Chip8Core is built with
+ * CHIP8_PROFILING (CMake option ENABLE_PROFILING); otherwise the hooks are
+ * compiled out and cost nothing.
+ */
+class Chip8Profiler
+{
+  public:
+    static constexpr size_t CLASS_COUNT = 37;
+    static constexpr size_t PC_COUNT    = 4096;
+
+    /**
+     * @brief Constructs an empty profiler.
+     * @param sampleInterval Time one instruction out of every sampleInterval.
+     */
+    explicit Chip8Profiler(uint32_t sampleInterval = 16);
+
+    /**
+     * @brief Clears all counters.
+     */
+    void reset();
+
+    void     setSampleInterval(uint32_t interval) { sampleInterval_ = interval ? interval : 1; }
+    uint32_t getSampleInterval() const { return sampleInterval_; }
+
+    /**
+     * @brief Returns true when the next instruction should be timed.
+     */
+    bool shouldSample() { return ++sinceSample_ >= sampleInterval_; }
+
+    /**
+     * @brief Records one executed instruction.
+     * @param pc The address the opcode was fetched from.
+     * @param opcode The executed opcode.
+     */
+    void record(uint16_t pc, uint16_t opcode)
+    {
+        ++instructions_;
+        ++classCounts_[classify(opcode)];
+        ++pcCounts_[pc & (PC_COUNT - 1)];
+    }
+
+    /**
+     * @brief Records the measured duration of a sampled instruction.
+     * @param opcode The executed opcode.
+     * @param elapsed Time between two timestamp() readings.
+     */
+    void recordSample(uint16_t opcode, uint64_t elapsed)
+    {
+        size_t opcodeClass = classify(opcode);
+        ++sampleCounts_[opcodeClass];
+        sampledTime_[opcodeClass] += elapsed;
+        sinceSample_ = 0;
+    }
+
+    /**
+     * @brief Reads the profiling clock.
+     */
+    static uint64_t timestamp();
+
+    /**
+     * @brief Unit of timestamp(): "tsc" or "ns".
+     */
+    static const char* getTimeUnit();
+
+    /**
+     * @brief Maps an opcode to its handler class, mirroring Chip8CPU dispatch.
+     */
+    static size_t classify(uint16_t opcode);
+
+    /**
+     * @brief Name of a handler class, e.g. "DXYN". The last class is "invalid".
+     */
+    static const char* className(size_t opcodeClass);
+
+    uint64_t getInstructionCount() const { return instructions_; }
+    uint64_t getClassCount(size_t opcodeClass) const { return classCounts_[opcodeClass]; }
+    uint64_t getPCCount(uint16_t pc) const { return pcCounts_[pc & (PC_COUNT - 1)]; }
+    uint64_t getSampleCount(size_t opcodeClass) const { return sampleCounts_[opcodeClass]; }
+    uint64_t getSampledTime(size_t opcodeClass) const { return sampledTime_[opcodeClass]; }
+
+    /**
+     * @brief Gets the most executed addresses, hottest first.
+     * @param count The maximum number of addresses to return.
+     */
+    std::vector<uint16_t> getHotPCs(size_t count) const;
+
+    /**
+     * @brief Writes a human readable report.
+     */
+    void dumpText(std::ostream& out, size_t hotPCs = 16) const;
+
+    /**
+     * @brief Writes the report as JSON.
+     */
+    void dumpJSON(std::ostream& out, size_t hotPCs = 16) const;
+
+  private:
+    uint32_t              sampleInterval_;
+    uint32_t              sinceSample_  = 0;
+    uint64_t              instructions_ = 0;
+    std::vector<uint64_t> classCounts_;
+    std::vector<uint64_t> sampleCounts_;
+    std::vector<uint64_t> sampledTime_;
+    std::vector<uint64_t> pcCounts_;
+};
+} // namespace chip8core
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+
+namespace chip8core
+{
+
+/**
+ * @brief Small per-instance xorshift32 generator used by CXKK.
+ *
+ * Unlike rand(), each machine owns its own state, so instances can be seeded
+ * reproducibly and stepped from different threads.
+ */
+class Chip8Random
+{
+  public:
+    explicit Chip8Random(uint32_t seed = 1) { setSeed(seed); }
+
+    /**
+     * @brief Reseeds the generator.
+     *
+     * The seed is mixed first, since xorshift started from nearby small seeds
+     * (such as the per-lane seeds of Chip8Batch) yields identical early bytes.
+     * A zero state is replaced as xorshift cannot leave zero.
+     */
+    void setSeed(uint32_t seed)
+    {
+        seed ^= seed >> 16;
+        seed *= 0x85EBCA6Bu;
+        seed ^= seed >> 13;
+        seed *= 0xC2B2AE35u;
+        seed ^= seed >> 16;
+        state_ = (seed != 0) ? seed : 0x2545F491u;
+    }
+
+    /**
+     * @brief Returns the next random byte.
+     */
+    uint8_t next()
+    {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 17;
+        state_ ^= state_ << 5;
+        return static_cast<uint8_t>(state_ >> 24);
+    }
+
+  private:
+    uint32_t state_;
+};
+} // namespace chip8core
@@ -0,0 +1,125 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Chip8Core/Chip8.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief Why a machine owned by a Chip8Runner stopped making progress.
+ */
+enum class Chip8ExitReason : uint8_t
+{
+    Running = 0, // Still executing
+    Halted  = 1, // Spinning on a jump to its own address
+    Fault   = 2  // Raised an exception (e.g. out of bounds memory access)
+};
+
+/**
+ * @brief Per-machine output of Chip8Runner::runFrames, stored contiguously.
+ */
+struct Chip8RunnerResult
+{
+    uint64_t        framebuffer[Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT]; // Packed rows
+    bool            soundOn;
+    Chip8ExitReason exitReason;
+};
+
+/**
+ * @brief Steps many Chip8 machines in parallel on a work-stealing thread pool.
+ *
+ * Machines are split into fixed batches that are dealt out to workers. A
+ * worker drains its own batches first and then steals remaining batches from
+ * the other workers. Every frame ends with a barrier, so all machines advance
+ * in lockstep one frame at a time.
+ */
+class Chip8Runner
+{
+  public:
+    /**
+     * @brief Constructs the runner and starts its worker threads.
+     * @param machines The number of machines to own.
+     * @param threads The number of workers, or 0 for one per hardware thread.
+     * @param pinThreads Pin each worker to a core where the platform supports it.
+     */
+    explicit Chip8Runner(size_t machines, size_t threads = 0, bool pinThreads = false);
+
+    /**
+     * @brief Stops and joins the worker threads.
+     */
+    ~Chip8Runner();
+
+    Chip8Runner(const Chip8Runner&)            = delete;
+    Chip8Runner& operator=(const Chip8Runner&) = delete;
+
+    /**
+     * @brief Resets every machine. Machine i is seeded with seed + i.
+     */
+    void reset(uint32_t seed = 1);
+
+    /**
+     * @brief Loads a ROM into every machine.
+     */
+    void loadROM(const uint8_t* romData, size_t romSize);
+
+    /**
+     * @brief Runs all machines for a number of frames and refreshes the results.
+     * @param frames The number of frames to run.
+     * @param cyclesPerFrame The number of CPU cycles per frame.
+     */
+    void runFrames(int frames, int cyclesPerFrame);
+
+    /**
+     * @brief Gets the results of the last runFrames call, one entry per machine.
+     */
+    const std::vector<Chip8RunnerResult>& getResults() const { return results_; }
+
+    /**
+     * @brief Gets a machine, e.g. to set its input between runFrames calls.
+     */
+    Chip8& getMachine(size_t index) { return *machines_[index]; }
+
+    size_t size() const { return machines_.size(); }
+    size_t getThreadCount() const { return workers_.size(); }
+
+  private:
+    static constexpr size_t MACHINES_PER_BATCH = 16;
+
+    /**
+     * @brief Range of batches dealt to one worker. Aligned to avoid false sharing.
+     */
+    struct alignas(64) WorkQueue
+    {
+        std::atomic<size_t> next{0};
+        size_t              end = 0;
+    };
+
+    std::vector<std::unique_ptr<Chip8>> machines_;
+    std::vector<Chip8RunnerResult>      results_;
+    std::vector<std::thread>            workers_;
+    std::unique_ptr<WorkQueue[]>        queues_;
+
+    std::mutex              mutex_;
+    std::condition_variable startFrame_;
+    std::condition_variable frameDone_;
+    uint64_t                generation_     = 0;
+    size_t                  pendingWorkers_ = 0;
+    bool                    stopping_       = false;
+    int                     cyclesPerFrame_ = 0;
+    bool                    lastFrame_      = false;
+
+    void workerLoop(size_t index);
+    bool nextBatch(size_t worker, size_t& batch);
+    void runBatch(size_t batch);
+    void runMachine(size_t index);
+    void pinToCore(std::thread& thread, size_t core);
+};
+} // namespace chip8core
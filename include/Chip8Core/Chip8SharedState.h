@@ -0,0 +1,105 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+#include "Chip8Core/Chip8GraphicsBuffer.h"
+#include "Chip8Core/Chip8SoundRenderer.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief Machine state shared by an emulation thread with readers that may be JavaScript.
+ *
+ * Lives in memory both sides can see, such as the SharedArrayBuffer behind a
+ * pthreads WASM heap. It holds only 32-bit atomic words, so a page reads it
+ * with a Uint32Array and Atomics.load() at the word offsets below. The
+ * emulation thread writes everything except keyMask and running, which
+ * belong to the page.
+ *
+ * The frame is guarded by a sequence lock: frameSequence is odd while the
+ * rows are written, and a reader that saw it odd or changed while copying
+ * tries again later. Sound edges go into a ring the reader follows with its
+ * own count; a reader that falls a whole ring behind skips the lost edges.
+ */
+class Chip8SharedState
+{
+  public:
+    static constexpr uint32_t FRAME_WORDS   = Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT * 2;
+    static constexpr uint32_t EDGE_CAPACITY = 64;
+    static constexpr uint32_t EDGE_WORDS    = 9; // Clock low, high, on, pitch, hasPattern, pattern
+
+    // Word offsets from the start of the state, for typed-array readers
+    static constexpr uint32_t FRAME_SEQUENCE = 0;
+    static constexpr uint32_t KEY_MASK       = 1; // Bit k set while key k is held
+    static constexpr uint32_t RUNNING        = 2; // Cleared by the page to stop the emulation
+    static constexpr uint32_t EDGE_COUNT     = 3; // Edges published; edge n is in slot n % capacity
+    static constexpr uint32_t CLOCK          = 4; // Chip8::getEmulatedClock(), low 32 bits
+    static constexpr uint32_t FRAME          = 5; // Packed rows as Chip8GraphicsBuffer::data()
+    static constexpr uint32_t EDGES          = FRAME + FRAME_WORDS;
+    static constexpr uint32_t WORDS          = EDGES + EDGE_CAPACITY * EDGE_WORDS;
+
+    Chip8SharedState();
+
+    /**
+     * @brief Copies a frame in under the sequence lock. Emulation side.
+     */
+    void publishFrame(const Chip8GraphicsBuffer& graphics);
+
+    /**
+     * @brief Copies the latest complete frame out.
+     * @param rows Receives FRAMEBUFFER_HEIGHT packed rows.
+     * @return False if a frame was being written; rows are then unchanged or torn.
+     */
+    bool readFrame(uint64_t* rows) const;
+
+    /**
+     * @brief Gets frameSequence / 2, the number of frames published.
+     */
+    uint32_t getFrameCount() const { return load(FRAME_SEQUENCE) / 2; }
+
+    /**
+     * @brief Adds a sound edge to the ring. Emulation side.
+     */
+    void publishEdge(const Chip8SoundEdge& edge);
+
+    /**
+     * @brief Reads the edge after the last one read.
+     * @param next The reader's edge count, starting at 0; advanced past the edge read.
+     * @return False if no edge was published since.
+     */
+    bool readEdge(uint32_t& next, Chip8SoundEdge& edge) const;
+
+    /**
+     * @brief Publishes how far the emulation has run, for readers that play the sound edges.
+     * The word wraps after about 71 days at 700Hz.
+     */
+    void     setClock(uint64_t clock) { store(CLOCK, static_cast<uint32_t>(clock)); }
+    uint32_t getClock() const { return load(CLOCK); }
+
+    void     setKeyMask(uint16_t keyMask) { store(KEY_MASK, keyMask); }
+    uint16_t getKeyMask() const { return static_cast<uint16_t>(load(KEY_MASK)); }
+    void     setRunning(bool running) { store(RUNNING, running ? 1 : 0); }
+    bool     isRunning() const { return load(RUNNING) != 0; }
+
+    /**
+     * @brief The first word, for views of the state from another language.
+     */
+    const std::atomic<uint32_t>* data() const { return words_; }
+
+  private:
+    static_assert(EDGE_WORDS == 5 + sizeof(Chip8SoundEdge::pattern) / 4,
+                  "The pattern packs four bytes to a word");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free &&
+                      sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+                  "Shared words must be plain 32-bit words to JavaScript");
+
+    uint32_t load(uint32_t word) const { return words_[word].load(std::memory_order_acquire); }
+    void     store(uint32_t word, uint32_t value)
+    {
+        words_[word].store(value, std::memory_order_release);
+    }
+
+    std::atomic<uint32_t> words_[WORDS];
+};
+} // namespace chip8core
@@ -0,0 +1,139 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Chip8Core/Chip8SpscQueue.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief The buzzer state from an emulated cycle on.
+ *
+ * Pushed when the sound timer starts or stops and when an XO-CHIP ROM loads
+ * an audio pattern or sets the pitch.
+ */
+struct Chip8SoundEdge
+{
+    uint64_t cycle; // Chip8::getEmulatedClock() at which the state takes effect
+    bool     on;
+    uint8_t  pitch;       // XO-CHIP pitch register
+    bool     hasPattern;  // False for the classic 440Hz buzzer
+    uint8_t  pattern[16]; // XO-CHIP 1-bit samples, most significant bit first
+};
+
+/**
+ * @brief Lock-free queue of sound edges from the emulation to the audio callback.
+ */
+using Chip8SoundQueue = Chip8SpscQueue<Chip8SoundEdge, 64>;
+
+/**
+ * @brief Renders the buzzer from sound edges, sample-accurately on the emulated clock.
+ *
+ * The emulation pushes an edge each time the sound timer becomes zero or
+ * non-zero and publishes its current cycle once per host frame. The audio
+ * callback plays the edges a fixed latency behind that cycle, starting and
+ * stopping the tone on the exact sample matching its emulated cycle, so a
+ * beep of N timer ticks always lasts N/60 seconds. The device never pauses;
+ * silence is rendered instead, which avoids the click of stopping it.
+ *
+ * The tone comes from a one-period wavetable stepped by a 32-bit fixed-point
+ * phase, and each run between edges is filled in one pass with no per-sample
+ * branch or modulo. The table holds a 440Hz square wave, or an XO-CHIP audio
+ * pattern expanded to two entries per bit. The phase steps of all 256 pitch
+ * register values are computed up front, so a pattern plays at
+ * 4000 * 2^((pitch - 64) / 48) bits per second with no per-sample division.
+ *
+ * The audio and host clocks drift apart, so the emulated time buffered ahead
+ * of playback is kept at the latency by dynamic rate control: while it is off
+ * by more than a third of the latency, playback runs up to MAX_RATE_ADJUST
+ * parts in CPU_HZ faster or slower, too little to hear. Smaller errors are
+ * left alone, since the emulation only catches up once per host frame. After
+ * a host stall, when the error exceeds the whole latency, playback jumps back
+ * in line. Emulation paced by the audio clock runs to getTargetCycle()
+ * instead, which keeps the buffer full by construction.
+ */
+class Chip8SoundRenderer
+{
+  public:
+    static constexpr uint8_t  SILENCE         = 0x80; // Centre of unsigned 8-bit audio
+    static constexpr size_t   WAVETABLE_SIZE  = 256;  // Indexed by the top 8 bits of the phase
+    static constexpr int      TONE_HZ         = 440;
+    static constexpr uint64_t LATENCY_CYCLES  = 35; // 50ms at 700Hz, over two host frames
+    static constexpr int      MAX_RATE_ADJUST = 3;  // 0.43% of CPU_HZ
+
+    /**
+     * @param sampleRate The output rate in Hz.
+     * @param latencyCycles How far playback runs behind the last published cycle.
+     */
+    explicit Chip8SoundRenderer(int sampleRate, uint64_t latencyCycles = LATENCY_CYCLES);
+
+    /**
+     * @brief The queue to attach to the machine with Chip8::attachSoundQueue().
+     */
+    Chip8SoundQueue& getQueue() { return queue_; }
+
+    /**
+     * @brief Publishes how far the emulation has run. Emulation side.
+     * @param cycle Chip8::getEmulatedClock() after the latest host frame.
+     */
+    void setEmulatedCycle(uint64_t cycle)
+    {
+        emulatedCycle_.store(cycle, std::memory_order_release);
+    }
+
+    /**
+     * @brief Fills a block of unsigned 8-bit mono samples. Audio callback side.
+     * @param out The block to fill.
+     * @param samples The number of samples in the block.
+     */
+    void render(uint8_t* out, size_t samples);
+
+    /**
+     * @brief Gets the cycle the emulation should have reached for the buffer to be full.
+     *
+     * Safe to call from the emulation thread; this is how the audio clock paces it.
+     */
+    uint64_t getTargetCycle() const
+    {
+        return playedCycle_.load(std::memory_order_acquire) + latencyCycles_;
+    }
+
+    /**
+     * @brief Gets the number of times playback jumped to catch up with the emulation.
+     */
+    uint64_t getResyncCount() const { return resyncs_; }
+
+    /**
+     * @brief Gets the current playback speed correction, in parts of CPU_HZ.
+     */
+    int getRateAdjust() const { return step_ - CPU_HZ_STEP; }
+
+  private:
+    static constexpr int CPU_HZ_STEP = 700; // Cursor units per sample at nominal speed
+
+    void updateRate(uint64_t target);
+    void setVoice(const Chip8SoundEdge& edge);
+    void loadSquareWave();
+    void fillTone(uint8_t* out, size_t samples);
+
+    Chip8SoundQueue       queue_;
+    std::atomic<uint64_t> emulatedCycle_{0};
+    std::atomic<uint64_t> playedCycle_{0};
+
+    uint64_t sampleRate_;
+    uint64_t latencyCycles_;
+    uint64_t cursor_     = 0; // Playback position in cycles times sampleRate_, step_ per sample
+    int      step_       = CPU_HZ_STEP;
+    uint32_t phase_      = 0; // Wavetable position, the top 8 bits index the table
+    uint32_t phaseStep_  = 0;
+    uint32_t squareStep_ = 0;
+    bool     on_         = false;
+    bool     hasPattern_ = false; // Whether wavetable_ holds pattern_ or the square wave
+    uint64_t resyncs_    = 0;
+    uint8_t  pattern_[16];
+    uint8_t  wavetable_[WAVETABLE_SIZE];
+    uint32_t pitchSteps_[256]; // Phase step of a pattern for each pitch register value
+};
+} // namespace chip8core
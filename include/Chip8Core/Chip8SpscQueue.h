@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+namespace chip8core
+{
+
+/**
+ * @brief Single-producer single-consumer lock-free ring of trivially copyable events.
+ *
+ * Producer and consumer may run on different threads, e.g. an SDL event loop
+ * feeding the emulator or the emulator feeding an audio callback. Each index
+ * is written by one side only and sits on its own cache line.
+ */
+template <typename T, size_t Capacity>
+class Chip8SpscQueue
+{
+  public:
+    static constexpr size_t CAPACITY = Capacity;
+
+    /**
+     * @brief Appends an event. Producer side only.
+     * @return False if the queue is full and the event was dropped.
+     */
+    bool push(const T& event)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == CAPACITY)
+        {
+            return false;
+        }
+        events_[tail & (CAPACITY - 1)] = event;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Reads the oldest event without removing it. Consumer side only.
+     * @return False if the queue is empty.
+     */
+    bool peek(T& event) const
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        event = events_[head & (CAPACITY - 1)];
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest event after a successful peek(). Consumer side only.
+     */
+    void pop()
+    {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    size_t size() const
+    {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+  private:
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "Indices wrap with a mask");
+
+    alignas(64) std::atomic<size_t> head_{0}; // Next event to read, written by the consumer
+    alignas(64) std::atomic<size_t> tail_{0}; // Next free slot, written by the producer
+    alignas(64) T events_[CAPACITY];
+};
+} // namespace chip8core
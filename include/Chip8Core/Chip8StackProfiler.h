@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <vector>
+
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8Symbols.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief Sampling profiler of the guest (ROM) call stack.
+ *
+ * Every sampleInterval instructions the CHIP-8 call stack is walked: each
+ * return address pushed by 2NNN is traced back to the call instruction before
+ * it to find the subroutine entered, and the current PC becomes the leaf
+ * frame. Identical stacks are counted together and written in the folded
+ * format read by flamegraph.pl, inferno and speedscope, one "outer;inner count"
+ * line per stack.
+ */
+class Chip8StackProfiler
+{
+  public:
+    /**
+     * @brief Constructs an empty profiler.
+     * @param sampleInterval Sample one instruction out of every sampleInterval.
+     *        An odd interval avoids locking onto the period of tight loops.
+     */
+    explicit Chip8StackProfiler(uint32_t sampleInterval = 97);
+
+    /**
+     * @brief Discards all samples.
+     */
+    void reset();
+
+    void     setSampleInterval(uint32_t interval) { sampleInterval_ = interval ? interval : 1; }
+    uint32_t getSampleInterval() const { return sampleInterval_; }
+
+    /**
+     * @brief Counts one executed instruction, sampling the stack when due.
+     * @param machine The machine, called after each Chip8::step().
+     */
+    void onInstruction(const Chip8& machine)
+    {
+        if (++sinceSample_ >= sampleInterval_)
+        {
+            sinceSample_ = 0;
+            sample(machine.getCPU(), machine.getMemory());
+        }
+    }
+
+    /**
+     * @brief Records the current call stack.
+     */
+    void sample(const Chip8CPU& cpu, const Chip8Memory& memory);
+
+    uint64_t getSampleCount() const { return samples_; }
+
+    /**
+     * @brief Sampled stacks, outermost frame first, with their sample counts.
+     */
+    const std::map<std::vector<uint16_t>, uint64_t>& getStacks() const { return stacks_; }
+
+    /**
+     * @brief Writes the samples as folded stacks.
+     * @param out The destination stream.
+     * @param symbols Optional labels; frames then name the enclosing label and
+     *        consecutive frames with the same name are merged.
+     */
+    void writeFolded(std::ostream& out, const Chip8Symbols* symbols = nullptr) const;
+
+  private:
+    uint32_t                                  sampleInterval_;
+    uint32_t                                  sinceSample_ = 0;
+    uint64_t                                  samples_     = 0;
+    std::vector<uint16_t>                     frames_; // Scratch stack reused between samples
+    std::map<std::vector<uint16_t>, uint64_t> stacks_;
+};
+} // namespace chip8core
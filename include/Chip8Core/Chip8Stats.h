@@ -0,0 +1,80 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "Chip8Core/Chip8Histogram.h"
+
+namespace chip8core
+{
+
+/**
+ * @brief Runtime performance counters of one machine and its frontend.
+ *
+ * Chip8 fills in the emulation counters itself; frontends add the time they
+ * spend rendering and feeding audio and record each host frame. Together they
+ * show whether the host keeps up with the 700Hz CPU or catches up in bursts.
+ */
+struct Chip8Stats
+{
+    static constexpr uint64_t FRAME_BUCKET_NS    = 1000000; // 1ms frame-time buckets
+    static constexpr size_t   FRAME_BUCKET_COUNT = 64;
+    static constexpr uint64_t PHASE_BUCKET_NS    = 100000;  // 0.1ms frame-phase buckets
+    static constexpr size_t   PHASE_BUCKET_COUNT = 200;
+
+    uint64_t instructions   = 0; // Emulated CPU instructions
+    uint64_t emulateNs      = 0; // Host time spent in Chip8::cycle()
+    uint64_t renderNs       = 0; // Host time spent drawing frames
+    uint64_t audioNs        = 0; // Host time spent updating audio
+    uint64_t cyclesCaughtUp = 0; // Cycles run beyond one timer tick's worth in a single cycle()
+    uint64_t cyclesDropped  = 0; // Emulated 700Hz clock cycles skipped when the host fell behind
+    uint64_t framesRendered = 0;
+    uint64_t framesSkipped  = 0; // Host frames not drawn because the framebuffer was unchanged
+
+    // Host frame intervals, then the time each host frame spent per phase, all in ns
+    Chip8Histogram frameTime{FRAME_BUCKET_NS, FRAME_BUCKET_COUNT};
+    Chip8Histogram emulateTime{PHASE_BUCKET_NS, PHASE_BUCKET_COUNT};
+    Chip8Histogram renderTime{PHASE_BUCKET_NS, PHASE_BUCKET_COUNT};
+    Chip8Histogram presentTime{PHASE_BUCKET_NS, PHASE_BUCKET_COUNT};
+
+    void reset() { *this = Chip8Stats(); }
+
+    /**
+     * @brief Records one host frame.
+     * @param intervalNs Time since the previous host frame started.
+     * @param rendered Whether the frame was drawn.
+     */
+    void recordFrame(uint64_t intervalNs, bool rendered)
+    {
+        ++(rendered ? framesRendered : framesSkipped);
+        frameTime.record(intervalNs);
+    }
+
+    /**
+     * @brief Records how long each phase of one host frame took.
+     */
+    void recordPhases(uint64_t emulate, uint64_t render, uint64_t present)
+    {
+        emulateTime.record(emulate);
+        renderTime.record(render);
+        presentTime.record(present);
+    }
+
+    /**
+     * @brief Writes a human readable summary with p50/p99 of every histogram.
+     * @param out The destination stream.
+     * @param label Identifies the run, e.g. the ROM and frontend.
+     */
+    void dumpText(std::ostream& out, const std::string& label) const;
+
+    /**
+     * @brief Reads the monotonic clock used for all counters, in nanoseconds.
+     */
+    static uint64_t now()
+    {
+        using namespace std::chrono;
+        return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+};
+} // namespace chip8core
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <string>
+
+namespace chip8core
+{
+
+/**
+ * @brief Maps ROM addresses to label names for profiler and debugger output.
+ *
+ * Labels can be read from a plain symbol map, one "address name" or
+ * "name address" pair per line, or recovered from Octo (.8o) sources by
+ * sizing every statement from the start of the program area. The Octo reader
+ * understands labels, :org, :alias, :const, :calc, :macro and :stringmode
+ * expansion, data bytes, :byte, :pointer, :unpack and all CHIP-8 statements;
+ * if it meets anything it cannot size it keeps the labels found so far.
+ */
+class Chip8Symbols
+{
+  public:
+    /**
+     * @brief Loads labels from a file, choosing the format from the extension.
+     * @param path A .8o Octo source or a symbol map.
+     * @return False if the file could not be opened.
+     */
+    bool load(const std::string& path);
+
+    /**
+     * @brief Reads labels from a symbol map.
+     */
+    void loadMap(std::istream& in);
+
+    /**
+     * @brief Reads labels from Octo source.
+     * @return The address after the last assembled byte, or 0 if sizing stopped early.
+     */
+    uint16_t loadOcto(std::istream& in);
+
+    /**
+     * @brief Adds or replaces a label.
+     */
+    void add(uint16_t address, const std::string& name) { labels_[address] = name; }
+
+    /**
+     * @brief Finds the label at or before an address.
+     * @return The label name, or the address in hex if there is none.
+     */
+    std::string symbolize(uint16_t address) const;
+
+    /**
+     * @brief Looks up the address of a label.
+     * @return True if the label exists.
+     */
+    bool find(const std::string& name, uint16_t& address) const;
+
+    bool   empty() const { return labels_.empty(); }
+    size_t size() const { return labels_.size(); }
+
+  private:
+    std::map<uint16_t, std::string> labels_;
+};
+} // namespace chip8core
@@ -15,6 +15,9 @@ class Chip8Timer
     uint8_t getValue() const { return currentValue_; }
     bool    isActive();
 
+    // The live counter, for zero-copy views
+    const uint8_t* data() const { return &currentValue_; }
+
   private:
     uint8_t currentValue_;
 };
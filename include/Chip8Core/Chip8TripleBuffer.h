@@ -0,0 +1,65 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+namespace chip8core
+{
+
+/**
+ * @brief Lock-free triple buffer handing the latest value from one thread to another.
+ *
+ * The producer fills back() and publishes it; the consumer acquires the most
+ * recently published value. Neither side ever waits: a producer publishing
+ * faster than the consumer reads simply replaces the unread value, and a slow
+ * consumer keeps reading its own slot while the producer carries on. Used to
+ * pass finished frames from the emulation thread to the presentation thread.
+ */
+template <typename T>
+class Chip8TripleBuffer
+{
+  public:
+    /**
+     * @brief The slot to fill before publish(). Producer side only.
+     */
+    T& back() { return slots_[back_]; }
+
+    /**
+     * @brief Makes back() the latest value and hands the producer a free slot.
+     */
+    void publish()
+    {
+        uint8_t previous = middle_.exchange(back_ | FRESH, std::memory_order_acq_rel);
+        back_            = previous & INDEX;
+    }
+
+    /**
+     * @brief Takes the latest published value. Consumer side only.
+     * @return The value, or nullptr if nothing was published since the last call.
+     */
+    const T* acquire()
+    {
+        if ((middle_.load(std::memory_order_relaxed) & FRESH) == 0)
+        {
+            return nullptr;
+        }
+        uint8_t previous = middle_.exchange(front_, std::memory_order_acq_rel);
+        front_           = previous & INDEX;
+        return &slots_[front_];
+    }
+
+    /**
+     * @brief The value returned by the last acquire(). Consumer side only.
+     */
+    const T& front() const { return slots_[front_]; }
+
+  private:
+    static constexpr uint8_t INDEX = 0x3; // Slot index bits of middle_
+    static constexpr uint8_t FRESH = 0x4; // Set while the middle slot is unread
+
+    T slots_[3];
+
+    alignas(64) std::atomic<uint8_t> middle_{1}; // Last published slot, swapped by both sides
+    alignas(64) uint8_t back_  = 0;              // Written by the producer
+    alignas(64) uint8_t front_ = 2;              // Read by the consumer
+};
+} // namespace chip8core
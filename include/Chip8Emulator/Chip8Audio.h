@@ -2,23 +2,50 @@
 
 #include <SDL2/SDL.h>
 
-#include <atomic>
-
-#include "Chip8Core/Chip8Timer.h"
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8SoundRenderer.h"
 
 class Chip8Audio
 {
   public:
-    Chip8Audio();
+    static constexpr int SAMPLE_RATE     = 44100;
+    static constexpr int DEFAULT_SAMPLES = 512;
+
+    /**
+     * @param bufferSamples Samples per device callback. Small buffers are safe
+     *        when the emulation is paced by getTargetCycle().
+     */
+    explicit Chip8Audio(int bufferSamples = DEFAULT_SAMPLES);
     ~Chip8Audio();
-    void processAudio(const chip8core::Chip8Timer& soundTimer);
+
+    /**
+     * @brief The queue to attach with Chip8::attachSoundQueue().
+     */
+    chip8core::Chip8SoundQueue& getSoundQueue() { return renderer_.getQueue(); }
+
+    /**
+     * @brief Tells the audio thread how far the emulation has run. Call once per host frame.
+     */
+    void processAudio(const chip8core::Chip8& chip8);
+
+    /**
+     * @brief Stops or restarts the device, e.g. while the emulation is paused.
+     */
+    void setPaused(bool paused);
+
+    /**
+     * @brief Whether the audio device opened. If not, nothing plays and getTargetCycle() stalls.
+     */
+    bool isOpen() const { return device_ != 0; }
+
+    /**
+     * @brief The cycle to run the emulation to when the audio clock paces it.
+     */
+    uint64_t getTargetCycle() const { return renderer_.getTargetCycle(); }
 
   private:
-    SDL_AudioDeviceID device_;
-    SDL_AudioSpec     spec_;
-    std::atomic<bool> playing_;
-    int               phase_;
-    void              play();
-    void              stop();
-    static void       audioCallback(void* userdata, Uint8* stream, int len);
-};
\ No newline at end of file
+    SDL_AudioDeviceID             device_;
+    SDL_AudioSpec                 spec_;
+    chip8core::Chip8SoundRenderer renderer_;
+    static void                   audioCallback(void* userdata, Uint8* stream, int len);
+};
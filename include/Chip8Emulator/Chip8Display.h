@@ -10,6 +10,21 @@ class Chip8Display
     ~Chip8Display();
     void render(const chip8core::Chip8GraphicsBuffer& buffer);
 
+    /**
+     * Draws the framebuffer into the back buffer without showing it.
+     */
+    void draw(const chip8core::Chip8GraphicsBuffer& buffer);
+
+    /**
+     * Shows the back buffer, which may wait for vsync.
+     */
+    void present();
+
+    /**
+     * Gets the refresh rate of the window's display in Hz, 60 if unknown.
+     */
+    int getRefreshRate() const;
+
   private:
     SDL_Window*   window_;
     SDL_Renderer* renderer_;
@@ -1,10 +1,17 @@
 #pragma once
 #include <SDL2/SDL.h>
 
-#include "Chip8Core/Chip8InputBuffer.h"
+#include "Chip8Core/Chip8InputQueue.h"
+#include "Chip8Core/Chip8LatencyTracker.h"
 
 class Chip8Input
 {
   public:
-    void pollEvents(chip8core::Chip8InputBuffer& input, bool& running);
-};
\ No newline at end of file
+    /**
+     * Polls SDL events and queues every mapped key press and release with its timestamp.
+     * Chip8::cycle() applies them at the matching emulated cycle once the queue is attached.
+     * @param latency If set, receives a timestamp for every key press or release seen.
+     */
+    void pollEvents(chip8core::Chip8InputQueue& queue, bool& running,
+                    chip8core::Chip8LatencyTracker* latency = nullptr);
+};
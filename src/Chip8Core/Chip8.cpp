@@ -2,6 +2,8 @@
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 namespace chip8core
 {
@@ -17,11 +19,16 @@ Chip8::~Chip8()
 
 void Chip8::reset()
 {
-    cpu_.reset();
     graphics_.clear();
     memory_.clear();
+    cpu_.reset(); // Reloads the font into the cleared memory
     delayTimer_.reset();
     soundTimer_.reset();
+    cycleCount_ = 0;
+    timerTicks_ = 0;
+    timerPhase_ = 0;
+    clockCarry_ = 0;
+    trackSoundEdge();
     spdlog::debug("Chip8 reset to initial state");
 }
 
@@ -34,35 +41,214 @@ void Chip8::loadROM(const uint8_t* romData, size_t romSize)
     spdlog::info("ROM loaded into memory");
 }
 
-void Chip8::cycle()
+int Chip8::cycle()
 {
     using namespace std::chrono;
-    auto   now   = steady_clock::now();
-    double delta = duration<double>(now - lastTick_).count();
+    auto now = steady_clock::now();
+    if (speed_ == UNLIMITED)
+    {
+        return cycleUnlimited(now);
+    }
+
+    double delta = duration<double>(now - lastTick_).count() * speed_;
     lastTick_    = now;
 
     cpuAccumulator_ += delta;
-    timerAccumulator_ += delta;
 
-    // Run as many CPU cycles as needed
-    while (cpuAccumulator_ >= CPU_CYCLE_TIME)
+    // Drop time the host could not give us rather than replaying it in one burst
+    double cycleTime = 1.0 / cpuHz_;
+    double maxLag    = MAX_LAG_TIME * speed_;
+    if (cpuAccumulator_ > maxLag)
+    {
+        auto dropped = static_cast<uint64_t>((cpuAccumulator_ - maxLag) / cycleTime);
+        stats_.cyclesDropped += dropped * CPU_HZ / cpuHz_;
+        cpuAccumulator_ -= dropped * cycleTime;
+    }
+
+    // Run the cycles owed, up to the budget; the timers follow the emulated clock
+    int budget   = static_cast<int>(CATCH_UP_BUDGET * speed_ * cpuHz_ / CPU_HZ);
+    int executed = std::min(static_cast<int>(cpuAccumulator_ / cycleTime), std::max(budget, 1));
+    cpuAccumulator_ -= executed * cycleTime;
+    runTimed(executed, now);
+    return executed;
+}
+
+int Chip8::cycleUnlimited(std::chrono::steady_clock::time_point start)
+{
+    // Whole frames until the slice is used up, so the timers keep their 60Hz emulated rate
+    auto sliceEnd = start + std::chrono::nanoseconds(UNLIMITED_SLICE_NS);
+    int  frame    = (cpuHz_ + TIMER_HZ - 1) / TIMER_HZ;
+    int  executed = 0;
+    for (auto now = start; now < sliceEnd; now = std::chrono::steady_clock::now())
     {
-        cpu_.cycle();
-        input_.syncKeyStates();
-        cpuAccumulator_ -= CPU_CYCLE_TIME;
+        runTimed(frame, now);
+        executed += frame;
     }
+    lastTick_       = std::chrono::steady_clock::now(); // A later setSpeed() starts from here
+    cpuAccumulator_ = 0.0;
+    return executed;
+}
+
+int Chip8::cycleUntil(uint64_t targetClock)
+{
+    auto now        = std::chrono::steady_clock::now();
+    lastTick_       = now; // cycle() carries on from here if pacing switches back
+    cpuAccumulator_ = 0.0;
 
-    // Update timers at 60Hz
-    while (timerAccumulator_ >= TIMER_CYCLE_TIME)
+    // Count in 1/(TIMER_HZ * cpuHz_) of a clock cycle, which getEmulatedClock() divides out, so
+    // a target that falls between two CPU cycles keeps its remainder for the next call
+    uint64_t scale   = static_cast<uint64_t>(TIMER_HZ) * cpuHz_;
+    uint64_t perStep = static_cast<uint64_t>(TIMER_HZ) * CPU_HZ; // One CPU cycle
+    uint64_t reached = (timerTicks_ * cpuHz_ + timerPhase_) * CPU_HZ + clockCarry_;
+    uint64_t target  = targetClock * scale;
+    uint64_t behind  = target - std::min(target, reached);
+    if (behind > MAX_LAG_CYCLES * scale)
     {
-        updateTimers();
-        timerAccumulator_ -= TIMER_CYCLE_TIME;
+        stats_.cyclesDropped += (behind - MAX_LAG_CYCLES * scale) / scale;
+        behind = MAX_LAG_CYCLES * scale;
     }
+
+    uint64_t owed  = clockCarry_ + behind;
+    uint64_t count = owed / perStep;
+    clockCarry_    = owed % perStep;
+    runTimed(count, now);
+    return static_cast<int>(count);
+}
+
+void Chip8::setCpuHz(int hz)
+{
+    hz          = std::max(hz, TIMER_HZ);
+    timerPhase_ = static_cast<int>(static_cast<int64_t>(timerPhase_) * hz / cpuHz_);
+    clockCarry_ = clockCarry_ * hz / cpuHz_;
+    cpuHz_      = hz;
+    updateHostRate();
+    spdlog::debug("Chip8 CPU rate set to {}Hz ({} cycles per frame)", cpuHz_, cpuHz_ / TIMER_HZ);
+}
+
+void Chip8::setSpeed(double speed)
+{
+    speed_          = std::max(speed, UNLIMITED);
+    cpuAccumulator_ = 0.0;
+    lastTick_       = std::chrono::steady_clock::now();
+    updateHostRate();
+    spdlog::debug("Chip8 speed set to {}x (0 for unlimited)", speed_);
+}
+
+void Chip8::updateHostRate()
+{
+    // Unlimited runs a frame per burst, so events land at the start of the next frame
+    double cyclesPerSecond = cpuHz_ * (speed_ == UNLIMITED ? 1e9 : speed_);
+    hostCycleNs_   = std::max<uint64_t>(static_cast<uint64_t>(1e9 / cyclesPerSecond), 1);
+    catchUpCycles_ = static_cast<uint64_t>(std::ceil(cyclesPerSecond / TIMER_HZ));
+}
+
+void Chip8::runTimed(uint64_t count, std::chrono::steady_clock::time_point now)
+{
+    using namespace std::chrono;
+    runCycles(count, duration_cast<nanoseconds>(now.time_since_epoch()).count());
+    if (speed_ != UNLIMITED && count > catchUpCycles_)
+    {
+        stats_.cyclesCaughtUp += count - catchUpCycles_;
+    }
+    stats_.emulateNs += duration_cast<nanoseconds>(steady_clock::now() - now).count();
+}
+
+void Chip8::runCycles(uint64_t count)
+{
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        timerPhase_ += TIMER_HZ; // First, so sound edges from step() carry this cycle's clock
+        step();
+        if (timerPhase_ >= cpuHz_)
+        {
+            timerPhase_ -= cpuHz_;
+            updateTimers();
+        }
+    }
+}
+
+void Chip8::runCycles(uint64_t count, uint64_t endNs)
+{
+    uint64_t      done = 0;
+    Chip8KeyEvent event;
+    while (inputQueue_ && done < count && inputQueue_->peek(event) && event.timestampNs <= endNs)
+    {
+        // Cycles between the event and endNs, so it lands before the first later cycle
+        uint64_t after = (endNs - event.timestampNs) / hostCycleNs_;
+        uint64_t at    = count - std::min(std::max<uint64_t>(after, 1), count);
+        if (at > done)
+        {
+            runCycles(at - done);
+            done = at;
+        }
+
+        uint16_t previous = input_.getKeyMask();
+        input_.setKeyState(event.key, event.pressed);
+        inputQueue_->pop();
+        if (inputObserver_ && input_.getKeyMask() != previous)
+        {
+            inputObserver_->onKeysChanged(cycleCount_, input_.getKeyMask());
+        }
+
+        // Give every event at least one cycle of its own
+        runCycles(1);
+        ++done;
+    }
+    runCycles(count - done);
+}
+
+void Chip8::step()
+{
+    cpu_.cycle();
+    input_.syncKeyStates();
+    ++cycleCount_;
+    ++stats_.instructions;
+    if (soundQueue_)
+    {
+        trackSoundEdge(); // FX18 may have started or stopped the tone
+    }
+}
+
+void Chip8::runFrame(int cyclesPerFrame)
+{
+    for (int i = 0; i < cyclesPerFrame; ++i)
+    {
+        step();
+    }
+    updateTimers();
 }
 
 void Chip8::updateTimers()
 {
+    ++timerTicks_;
     delayTimer_.update();
     soundTimer_.update();
+    trackSoundEdge();
+}
+
+void Chip8::attachSoundQueue(Chip8SoundQueue* queue)
+{
+    soundQueue_ = queue;
+    soundOn_    = !(soundTimer_.getValue() > 0); // Forces the current state out
+    trackSoundEdge();
+}
+
+void Chip8::trackSoundEdge()
+{
+    bool     on    = soundTimer_.getValue() > 0;
+    uint32_t voice = cpu_.getAudioGeneration();
+    if (!soundQueue_ || (on == soundOn_ && voice == soundVoice_))
+    {
+        return;
+    }
+
+    Chip8SoundEdge edge{getEmulatedClock(), on, cpu_.getPitch(), cpu_.hasAudioPattern(), {}};
+    std::copy_n(cpu_.getAudioPattern(), Chip8CPU::AUDIO_PATTERN_SIZE, edge.pattern);
+    if (soundQueue_->push(edge))
+    {
+        // Only remembered once queued, so a full queue retries next cycle
+        soundOn_    = on;
+        soundVoice_ = voice;
+    }
 }
 } // namespace chip8core
\ No newline at end of file
@@ -0,0 +1,514 @@
+#include "Chip8Core/Chip8Batch.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+#include "Chip8Core/Chip8CPU.h"
+
+namespace chip8core
+{
+static_assert(Chip8Batch::AUDIO_PATTERN_SIZE == Chip8CPU::AUDIO_PATTERN_SIZE,
+              "Lanes hold the same XO-CHIP pattern as Chip8CPU");
+
+Chip8Batch::Chip8Batch(size_t lanes)
+    : lanes_(lanes), V_(16 * lanes), I_(lanes), PC_(lanes), SP_(lanes), stack_(16 * lanes),
+      delayTimer_(lanes), soundTimer_(lanes), keys_(lanes), prevKeys_(lanes), pitch_(lanes),
+      hasAudioPattern_(lanes), audioPatterns_(AUDIO_PATTERN_SIZE * lanes), random_(lanes),
+      framebuffers_(Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT * lanes),
+      memory_(Chip8Memory::MEMORY_SIZE * lanes)
+{
+    reset();
+    spdlog::debug("Chip8 Batch created with {} lanes", lanes_);
+}
+
+Chip8Batch::~Chip8Batch()
+{
+    spdlog::debug("Chip8 Batch destroyed");
+}
+
+void Chip8Batch::reset(uint32_t seed)
+{
+    std::fill(V_.begin(), V_.end(), 0);
+    std::fill(I_.begin(), I_.end(), 0);
+    std::fill(PC_.begin(), PC_.end(), PROGRAM_START);
+    std::fill(SP_.begin(), SP_.end(), 0);
+    std::fill(stack_.begin(), stack_.end(), 0);
+    std::fill(delayTimer_.begin(), delayTimer_.end(), 0);
+    std::fill(soundTimer_.begin(), soundTimer_.end(), 0);
+    std::fill(keys_.begin(), keys_.end(), 0);
+    std::fill(prevKeys_.begin(), prevKeys_.end(), 0);
+    std::fill(pitch_.begin(), pitch_.end(), Chip8CPU::DEFAULT_PITCH);
+    std::fill(hasAudioPattern_.begin(), hasAudioPattern_.end(), 0);
+    std::fill(audioPatterns_.begin(), audioPatterns_.end(), 0);
+    std::fill(framebuffers_.begin(), framebuffers_.end(), 0);
+    std::fill(memory_.begin(), memory_.end(), 0);
+
+    for (size_t lane = 0; lane < lanes_; ++lane)
+    {
+        random_[lane].setSeed(seed + static_cast<uint32_t>(lane));
+        std::copy(std::begin(Chip8CPU::chip8Font), std::end(Chip8CPU::chip8Font),
+                  &laneMemory(lane, FONT_ADDRESS));
+    }
+    uniformSteps_   = 0;
+    divergentSteps_ = 0;
+    spdlog::debug("Chip8 Batch reset to initial state");
+}
+
+void Chip8Batch::loadROM(const uint8_t* romData, size_t romSize)
+{
+    size_t length = std::min<size_t>(romSize, Chip8Memory::MEMORY_SIZE - PROGRAM_START);
+    for (size_t lane = 0; lane < lanes_; ++lane)
+    {
+        std::copy(romData, romData + length, &laneMemory(lane, PROGRAM_START));
+    }
+    spdlog::info("ROM loaded into {} lanes", lanes_);
+}
+
+uint8_t& Chip8Batch::laneMemory(size_t lane, uint16_t address)
+{
+    return memory_[lane * Chip8Memory::MEMORY_SIZE + (address & ADDRESS_MASK)];
+}
+
+uint16_t Chip8Batch::fetch(size_t lane) const
+{
+    return readMemory(lane, PC_[lane]) << 8 | readMemory(lane, PC_[lane] + 1);
+}
+
+void Chip8Batch::step()
+{
+    if (lanes_ == 0)
+    {
+        return;
+    }
+
+    // The common case: every lane is at the same address running the same code
+    uint16_t pc      = PC_[0];
+    uint16_t opcode  = fetch(0);
+    bool     uniform = true;
+    for (size_t lane = 1; lane < lanes_ && uniform; ++lane)
+    {
+        uniform = PC_[lane] == pc && fetch(lane) == opcode;
+    }
+
+    if (uniform)
+    {
+        ++uniformSteps_;
+        for (size_t lane = 0; lane < lanes_; ++lane)
+        {
+            PC_[lane] += 2;
+        }
+        if (!executeUniform(opcode))
+        {
+            for (size_t lane = 0; lane < lanes_; ++lane)
+            {
+                executeLane(lane, opcode);
+            }
+        }
+    }
+    else
+    {
+        ++divergentSteps_;
+        for (size_t lane = 0; lane < lanes_; ++lane)
+        {
+            uint16_t laneOpcode = fetch(lane);
+            PC_[lane] += 2;
+            executeLane(lane, laneOpcode);
+        }
+    }
+
+    std::copy(keys_.begin(), keys_.end(), prevKeys_.begin());
+}
+
+void Chip8Batch::runFrame(int cyclesPerFrame)
+{
+    for (int i = 0; i < cyclesPerFrame; ++i)
+    {
+        step();
+    }
+    updateTimers();
+}
+
+void Chip8Batch::updateTimers()
+{
+    for (size_t lane = 0; lane < lanes_; ++lane)
+    {
+        delayTimer_[lane] -= delayTimer_[lane] > 0 ? 1 : 0;
+        soundTimer_[lane] -= soundTimer_[lane] > 0 ? 1 : 0;
+    }
+}
+
+/**
+ * Executes an opcode on every lane at once. The loops below only touch
+ * contiguous per-register arrays so they compile to SIMD across lanes.
+ * Returns false for instructions that need the per-lane path.
+ */
+bool Chip8Batch::executeUniform(uint16_t opcode)
+{
+    uint8_t  x   = (opcode >> 8) & 0xF;
+    uint8_t  y   = (opcode >> 4) & 0xF;
+    uint8_t  kk  = opcode & 0xFF;
+    uint16_t nnn = opcode & 0x0FFF;
+
+    uint8_t*  vx = lanesOf(x);
+    uint8_t*  vy = lanesOf(y);
+    uint8_t*  vf = lanesOf(0xF);
+    uint16_t* pc = PC_.data();
+    size_t    n  = lanes_;
+
+    switch (opcode >> 12)
+    {
+    case 0x1: // JP addr
+        std::fill(PC_.begin(), PC_.end(), nnn);
+        return true;
+    case 0x3: // SE Vx, byte
+        for (size_t l = 0; l < n; ++l)
+            pc[l] += (vx[l] == kk) ? 2 : 0;
+        return true;
+    case 0x4: // SNE Vx, byte
+        for (size_t l = 0; l < n; ++l)
+            pc[l] += (vx[l] != kk) ? 2 : 0;
+        return true;
+    case 0x5: // SE Vx, Vy
+        for (size_t l = 0; l < n; ++l)
+            pc[l] += (vx[l] == vy[l]) ? 2 : 0;
+        return true;
+    case 0x6: // LD Vx, byte
+        std::fill(vx, vx + n, kk);
+        return true;
+    case 0x7: // ADD Vx, byte
+        for (size_t l = 0; l < n; ++l)
+            vx[l] += kk;
+        return true;
+    case 0x8:
+        switch (opcode & 0xF)
+        {
+        case 0x0:
+            for (size_t l = 0; l < n; ++l)
+                vx[l] = vy[l];
+            return true;
+        case 0x1:
+            for (size_t l = 0; l < n; ++l)
+                vx[l] |= vy[l];
+            return true;
+        case 0x2:
+            for (size_t l = 0; l < n; ++l)
+                vx[l] &= vy[l];
+            return true;
+        case 0x3:
+            for (size_t l = 0; l < n; ++l)
+                vx[l] ^= vy[l];
+            return true;
+        case 0x4:
+            for (size_t l = 0; l < n; ++l)
+            {
+                uint8_t a = vx[l];
+                uint8_t b = vy[l];
+                vx[l]     = a + b;
+                vf[l]     = (a + b) > 0xFF ? 1 : 0;
+            }
+            return true;
+        case 0x5:
+            for (size_t l = 0; l < n; ++l)
+            {
+                uint8_t a = vx[l];
+                uint8_t b = vy[l];
+                vx[l]     = a - b;
+                vf[l]     = a >= b ? 1 : 0;
+            }
+            return true;
+        case 0x6:
+            for (size_t l = 0; l < n; ++l)
+            {
+                uint8_t a = vx[l];
+                vx[l]     = a >> 1;
+                vf[l]     = a & 0x01;
+            }
+            return true;
+        case 0x7:
+            for (size_t l = 0; l < n; ++l)
+            {
+                uint8_t a = vx[l];
+                uint8_t b = vy[l];
+                vx[l]     = b - a;
+                vf[l]     = b >= a ? 1 : 0;
+            }
+            return true;
+        case 0xE:
+            for (size_t l = 0; l < n; ++l)
+            {
+                uint8_t a = vx[l];
+                vx[l]     = a << 1;
+                vf[l]     = a >> 7;
+            }
+            return true;
+        default:
+            return false;
+        }
+    case 0x9: // SNE Vx, Vy
+        for (size_t l = 0; l < n; ++l)
+            pc[l] += (vx[l] != vy[l]) ? 2 : 0;
+        return true;
+    case 0xA: // LD I, addr
+        std::fill(I_.begin(), I_.end(), nnn);
+        return true;
+    case 0xF:
+        switch (kk)
+        {
+        case 0x07:
+            std::copy(delayTimer_.begin(), delayTimer_.end(), vx);
+            return true;
+        case 0x15:
+            std::copy(vx, vx + n, delayTimer_.begin());
+            return true;
+        case 0x18:
+            std::copy(vx, vx + n, soundTimer_.begin());
+            return true;
+        case 0x3A:
+            std::copy(vx, vx + n, pitch_.begin());
+            return true;
+        case 0x1E:
+            for (size_t l = 0; l < n; ++l)
+                I_[l] += vx[l];
+            return true;
+        case 0x29:
+            for (size_t l = 0; l < n; ++l)
+                I_[l] = FONT_ADDRESS + vx[l] * 5;
+            return true;
+        default:
+            return false;
+        }
+    default:
+        return false;
+    }
+}
+
+/**
+ * Executes an opcode on a single lane. Decoding mirrors the Chip8CPU dispatch
+ * tables, including which low nibbles select 00E0/00EE and EX9E/EXA1.
+ */
+void Chip8Batch::executeLane(size_t lane, uint16_t opcode)
+{
+    uint8_t  x   = (opcode >> 8) & 0xF;
+    uint8_t  y   = (opcode >> 4) & 0xF;
+    uint8_t  kk  = opcode & 0xFF;
+    uint16_t nnn = opcode & 0x0FFF;
+
+    uint16_t& pc = PC_[lane];
+    uint16_t& i  = I_[lane];
+    uint8_t&  sp = SP_[lane];
+    uint8_t&  vx = reg(lane, x);
+    uint8_t&  vy = reg(lane, y);
+    uint8_t&  vf = reg(lane, 0xF);
+
+    switch (opcode >> 12)
+    {
+    case 0x0:
+        if ((opcode & 0xF) == 0x0)
+        {
+            std::fill_n(&framebuffers_[lane * Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT],
+                        Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT, 0);
+        }
+        else if ((opcode & 0xF) == 0xE)
+        {
+            pc = stackAt(lane, sp);
+            sp = (sp - 1) & 0xF; // 16 levels that wrap, as in Chip8CPU
+        }
+        else
+        {
+            spdlog::error("Invalid or unimplemented opcode: {:#04x}", opcode);
+        }
+        break;
+    case 0x1:
+        pc = nnn;
+        break;
+    case 0x2:
+        sp                = (sp + 1) & 0xF;
+        stackAt(lane, sp) = pc;
+        pc                = nnn;
+        break;
+    case 0x3:
+        pc += (vx == kk) ? 2 : 0;
+        break;
+    case 0x4:
+        pc += (vx != kk) ? 2 : 0;
+        break;
+    case 0x5:
+        pc += (vx == vy) ? 2 : 0;
+        break;
+    case 0x6:
+        vx = kk;
+        break;
+    case 0x7:
+        vx += kk;
+        break;
+    case 0x8:
+    {
+        uint8_t a = vx;
+        uint8_t b = vy;
+        switch (opcode & 0xF)
+        {
+        case 0x0:
+            vx = b;
+            break;
+        case 0x1:
+            vx = a | b;
+            break;
+        case 0x2:
+            vx = a & b;
+            break;
+        case 0x3:
+            vx = a ^ b;
+            break;
+        case 0x4:
+            vx = a + b;
+            vf = (a + b) > 0xFF ? 1 : 0;
+            break;
+        case 0x5:
+            vx = a - b;
+            vf = a >= b ? 1 : 0;
+            break;
+        case 0x6:
+            vx = a >> 1;
+            vf = a & 0x01;
+            break;
+        case 0x7:
+            vx = b - a;
+            vf = b >= a ? 1 : 0;
+            break;
+        case 0xE:
+            vx = a << 1;
+            vf = a >> 7;
+            break;
+        default:
+            spdlog::error("Invalid or unimplemented opcode: {:#04x}", opcode);
+            break;
+        }
+        break;
+    }
+    case 0x9:
+        pc += (vx != vy) ? 2 : 0;
+        break;
+    case 0xA:
+        i = nnn;
+        break;
+    case 0xB:
+        pc = nnn + reg(lane, 0);
+        break;
+    case 0xC:
+        vx = random_[lane].next() & kk;
+        break;
+    case 0xD:
+        drawSprite(lane, opcode);
+        break;
+    case 0xE:
+    {
+        bool pressed = vx < 16 && ((keys_[lane] >> vx) & 1);
+        if ((opcode & 0xF) == 0xE)
+        {
+            pc += pressed ? 2 : 0;
+        }
+        else if ((opcode & 0xF) == 0x1)
+        {
+            pc += pressed ? 0 : 2;
+        }
+        else
+        {
+            spdlog::error("Invalid or unimplemented opcode: {:#04x}", opcode);
+        }
+        break;
+    }
+    case 0xF:
+        switch (kk)
+        {
+        case 0x02:
+            for (size_t b = 0; b < AUDIO_PATTERN_SIZE; ++b)
+            {
+                audioPatterns_[lane * AUDIO_PATTERN_SIZE + b] = laneMemory(lane, i + b);
+            }
+            hasAudioPattern_[lane] = 1;
+            break;
+        case 0x07:
+            vx = delayTimer_[lane];
+            break;
+        case 0x0A:
+        {
+            uint16_t released = prevKeys_[lane] & ~keys_[lane];
+            if (released == 0)
+            {
+                pc -= 2;
+                break;
+            }
+            uint8_t key = 0;
+            while (((released >> key) & 1) == 0)
+            {
+                ++key;
+            }
+            vx = key;
+            break;
+        }
+        case 0x15:
+            delayTimer_[lane] = vx;
+            break;
+        case 0x18:
+            soundTimer_[lane] = vx;
+            break;
+        case 0x1E:
+            i += vx;
+            break;
+        case 0x29:
+            i = FONT_ADDRESS + vx * 5;
+            break;
+        case 0x33:
+            laneMemory(lane, i)     = (vx / 100) % 10;
+            laneMemory(lane, i + 1) = (vx / 10) % 10;
+            laneMemory(lane, i + 2) = vx % 10;
+            break;
+        case 0x3A:
+            pitch_[lane] = vx;
+            break;
+        case 0x55:
+            for (uint8_t r = 0; r <= x; ++r)
+            {
+                laneMemory(lane, i + r) = reg(lane, r);
+            }
+            break;
+        case 0x65:
+            for (uint8_t r = 0; r <= x; ++r)
+            {
+                reg(lane, r) = laneMemory(lane, i + r);
+            }
+            break;
+        default:
+            spdlog::error("Invalid or unimplemented opcode: {:#04x}", opcode);
+            break;
+        }
+        break;
+    }
+}
+
+void Chip8Batch::drawSprite(size_t lane, uint16_t opcode)
+{
+    constexpr int WIDTH  = Chip8GraphicsBuffer::FRAMEBUFFER_WIDTH;
+    constexpr int HEIGHT = Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT;
+
+    unsigned  x         = reg(lane, (opcode >> 8) & 0xF) % WIDTH;
+    unsigned  y         = reg(lane, (opcode >> 4) & 0xF);
+    uint8_t   n         = opcode & 0xF;
+    uint64_t* rows      = &framebuffers_[lane * HEIGHT];
+    bool      collision = false;
+
+    for (uint8_t row = 0; row < n; ++row)
+    {
+        uint64_t line = static_cast<uint64_t>(laneMemory(lane, I_[lane] + row)) << (WIDTH - 8);
+        if (x != 0)
+        {
+            line = (line >> x) | (line << (WIDTH - x));
+        }
+        uint64_t& target = rows[(y + row) % HEIGHT];
+        collision |= (target & line) != 0;
+        target ^= line;
+    }
+    reg(lane, 0xF) = collision ? 1 : 0;
+}
+} // namespace chip8core
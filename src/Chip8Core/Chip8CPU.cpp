@@ -2,17 +2,16 @@
 
 #include <spdlog/spdlog.h>
 
-#include <bitset>
 #include <cstdio>
+#include <random>
 namespace chip8core
 {
 Chip8CPU::Chip8CPU(Chip8Memory& memory, Chip8GraphicsBuffer& graphics, Chip8InputBuffer& input,
                    Chip8Timer& delayTimer, Chip8Timer& soundTimer)
-    : memory_(memory), graphics_(graphics), input_(input), delayTimer_(delayTimer),
-      soundTimer_(soundTimer)
+    : seed_(std::random_device{}()), memory_(memory), graphics_(graphics), input_(input),
+      delayTimer_(delayTimer), soundTimer_(soundTimer)
 {
     reset();
-    initializeOpcodeTables();
     spdlog::debug("Chip8 CPU created");
 }
 
@@ -25,6 +24,17 @@ void Chip8CPU::cycle()
 {
     // Fetch opcode
     uint16_t opcode = memory_.read(PC_) << 8 | memory_.read(PC_ + 1);
+#ifdef CHIP8_PROFILING
+    profiler_.record(PC_, opcode);
+    if (profiler_.shouldSample())
+    {
+        uint64_t start = Chip8Profiler::timestamp();
+        PC_ += 2;
+        decodeOpcode(opcode);
+        profiler_.recordSample(opcode, Chip8Profiler::timestamp() - start);
+        return;
+    }
+#endif
     PC_ += 2;
     decodeOpcode(opcode);
 }
@@ -36,7 +46,13 @@ void Chip8CPU::reset()
     I_  = 0;                                    // Reset index register
     std::fill(std::begin(V_), std::end(V_), 0); // Clear registers
     std::fill(std::begin(stack_), std::end(stack_), 0); // Clear stack
-    srand(time(nullptr));                               // Seed random number generator
+    random_.setSeed(seed_);                             // Seed random number generator
+    std::fill(std::begin(audioPattern_), std::end(audioPattern_), 0);
+    hasAudioPattern_ = false;
+    pitch_           = DEFAULT_PITCH;
+    ++audioGeneration_;
+    invalidOpcodes_ = 0;
+    faultPC_        = 0;
     loadFont();
     spdlog::debug("Chip8 CPU reset to initial state");
 }
@@ -54,73 +70,84 @@ void Chip8CPU::loadFont()
     }
 }
 
-void Chip8CPU::initializeOpcodeTables()
+constexpr Chip8CPU::OpcodeTables Chip8CPU::initializeOpcodeTables()
 {
-    spdlog::debug("Initializing opcode tables");
+    OpcodeTables tables{};
+
     // Initialize all entries to invalidOpcode
-    for (auto& handler : main_opcode_table_)
+    for (auto& handler : tables.main_opcode_table_)
         handler = &Chip8CPU::invalidOpcode;
-    for (auto& handler : _0_table)
+    for (auto& handler : tables._0_table)
         handler = &Chip8CPU::invalidOpcode;
-    for (auto& handler : _8_table)
+    for (auto& handler : tables._8_table)
         handler = &Chip8CPU::invalidOpcode;
-    for (auto& handler : _E_table)
+    for (auto& handler : tables._E_table)
         handler = &Chip8CPU::invalidOpcode;
-    for (auto& handler : _F_table)
+    for (auto& handler : tables._F_table)
         handler = &Chip8CPU::invalidOpcode;
 
     // Initialize main opcode table
-    main_opcode_table_[0x0] = &Chip8CPU::handle_0XXX;
-    main_opcode_table_[0x1] = &Chip8CPU::opcode_1NNN;
-    main_opcode_table_[0x2] = &Chip8CPU::opcode_2NNN;
-    main_opcode_table_[0x3] = &Chip8CPU::opcode_3XKK;
-    main_opcode_table_[0x4] = &Chip8CPU::opcode_4XKK;
-    main_opcode_table_[0x5] = &Chip8CPU::opcode_5XY0;
-    main_opcode_table_[0x6] = &Chip8CPU::opcode_6XKK;
-    main_opcode_table_[0x7] = &Chip8CPU::opcode_7XKK;
-    main_opcode_table_[0x8] = &Chip8CPU::handle_8XXX;
-    main_opcode_table_[0x9] = &Chip8CPU::opcode_9XY0;
-    main_opcode_table_[0xA] = &Chip8CPU::opcode_ANNN;
-    main_opcode_table_[0xB] = &Chip8CPU::opcode_BNNN;
-    main_opcode_table_[0xC] = &Chip8CPU::opcode_CXKK;
-    main_opcode_table_[0xD] = &Chip8CPU::opcode_DXYN;
-    main_opcode_table_[0xE] = &Chip8CPU::handle_EXXX;
-    main_opcode_table_[0xF] = &Chip8CPU::handle_FXXX;
+    tables.main_opcode_table_[0x0] = &Chip8CPU::handle_0XXX;
+    tables.main_opcode_table_[0x1] = &Chip8CPU::opcode_1NNN;
+    tables.main_opcode_table_[0x2] = &Chip8CPU::opcode_2NNN;
+    tables.main_opcode_table_[0x3] = &Chip8CPU::opcode_3XKK;
+    tables.main_opcode_table_[0x4] = &Chip8CPU::opcode_4XKK;
+    tables.main_opcode_table_[0x5] = &Chip8CPU::opcode_5XY0;
+    tables.main_opcode_table_[0x6] = &Chip8CPU::opcode_6XKK;
+    tables.main_opcode_table_[0x7] = &Chip8CPU::opcode_7XKK;
+    tables.main_opcode_table_[0x8] = &Chip8CPU::handle_8XXX;
+    tables.main_opcode_table_[0x9] = &Chip8CPU::opcode_9XY0;
+    tables.main_opcode_table_[0xA] = &Chip8CPU::opcode_ANNN;
+    tables.main_opcode_table_[0xB] = &Chip8CPU::opcode_BNNN;
+    tables.main_opcode_table_[0xC] = &Chip8CPU::opcode_CXKK;
+    tables.main_opcode_table_[0xD] = &Chip8CPU::opcode_DXYN;
+    tables.main_opcode_table_[0xE] = &Chip8CPU::handle_EXXX;
+    tables.main_opcode_table_[0xF] = &Chip8CPU::handle_FXXX;
 
     // Initialize 0XXX opcode table
-    _0_table[0x0] = &Chip8CPU::opcode_00E0;
-    _0_table[0xE] = &Chip8CPU::opcode_00EE;
+    tables._0_table[0x0] = &Chip8CPU::opcode_00E0;
+    tables._0_table[0xE] = &Chip8CPU::opcode_00EE;
 
     // Initialize 8XXX opcode table
-    _8_table[0x0] = &Chip8CPU::opcode_8XY0;
-    _8_table[0x1] = &Chip8CPU::opcode_8XY1;
-    _8_table[0x2] = &Chip8CPU::opcode_8XY2;
-    _8_table[0x3] = &Chip8CPU::opcode_8XY3;
-    _8_table[0x4] = &Chip8CPU::opcode_8XY4;
-    _8_table[0x5] = &Chip8CPU::opcode_8XY5;
-    _8_table[0x6] = &Chip8CPU::opcode_8XY6;
-    _8_table[0x7] = &Chip8CPU::opcode_8XY7;
-    _8_table[0xE] = &Chip8CPU::opcode_8XYE;
+    tables._8_table[0x0] = &Chip8CPU::opcode_8XY0;
+    tables._8_table[0x1] = &Chip8CPU::opcode_8XY1;
+    tables._8_table[0x2] = &Chip8CPU::opcode_8XY2;
+    tables._8_table[0x3] = &Chip8CPU::opcode_8XY3;
+    tables._8_table[0x4] = &Chip8CPU::opcode_8XY4;
+    tables._8_table[0x5] = &Chip8CPU::opcode_8XY5;
+    tables._8_table[0x6] = &Chip8CPU::opcode_8XY6;
+    tables._8_table[0x7] = &Chip8CPU::opcode_8XY7;
+    tables._8_table[0xE] = &Chip8CPU::opcode_8XYE;
 
     // Initialize EXXX opcode table
-    _E_table[0x1] = &Chip8CPU::opcode_EXA1;
-    _E_table[0xE] = &Chip8CPU::opcode_EX9E;
+    tables._E_table[0x1] = &Chip8CPU::opcode_EXA1;
+    tables._E_table[0xE] = &Chip8CPU::opcode_EX9E;
 
     // Initialize FXXX opcode table
-    _F_table[0x07] = &Chip8CPU::opcode_FX07;
-    _F_table[0x0A] = &Chip8CPU::opcode_FX0A;
-    _F_table[0x15] = &Chip8CPU::opcode_FX15;
-    _F_table[0x18] = &Chip8CPU::opcode_FX18;
-    _F_table[0x1E] = &Chip8CPU::opcode_FX1E;
-    _F_table[0x29] = &Chip8CPU::opcode_FX29;
-    _F_table[0x33] = &Chip8CPU::opcode_FX33;
-    _F_table[0x55] = &Chip8CPU::opcode_FX55;
-    _F_table[0x65] = &Chip8CPU::opcode_FX65;
+    tables._F_table[0x02] = &Chip8CPU::opcode_F002;
+    tables._F_table[0x07] = &Chip8CPU::opcode_FX07;
+    tables._F_table[0x0A] = &Chip8CPU::opcode_FX0A;
+    tables._F_table[0x15] = &Chip8CPU::opcode_FX15;
+    tables._F_table[0x18] = &Chip8CPU::opcode_FX18;
+    tables._F_table[0x1E] = &Chip8CPU::opcode_FX1E;
+    tables._F_table[0x29] = &Chip8CPU::opcode_FX29;
+    tables._F_table[0x33] = &Chip8CPU::opcode_FX33;
+    tables._F_table[0x3A] = &Chip8CPU::opcode_FX3A;
+    tables._F_table[0x55] = &Chip8CPU::opcode_FX55;
+    tables._F_table[0x65] = &Chip8CPU::opcode_FX65;
+
+    return tables;
 }
 
+const Chip8CPU::OpcodeTables Chip8CPU::opcodeTables_ = Chip8CPU::initializeOpcodeTables();
+
 void Chip8CPU::invalidOpcode(uint16_t opcode)
 {
     spdlog::error("Invalid or unimplemented opcode: {:#04x}", opcode);
+    if (invalidOpcodes_++ == 0)
+    {
+        faultPC_ = PC_ - 2; // PC already points past the opcode
+    }
 }
 
 void Chip8CPU::decodeOpcode(uint16_t opcode)
@@ -131,13 +158,13 @@ void Chip8CPU::decodeOpcode(uint16_t opcode)
     uint8_t main_opcode = (opcode >> 12) & 0xF;
 
     // Call the appropriate handler based on the main opcode
-    if (main_opcode < main_opcode_table_.size())
+    if (main_opcode < opcodeTables_.main_opcode_table_.size())
     {
-        (this->*main_opcode_table_[main_opcode])(opcode);
+        (this->*opcodeTables_.main_opcode_table_[main_opcode])(opcode);
     }
     else
     {
-        spdlog::error("Unknown opcode: {:#04x}", opcode);
+        invalidOpcode(opcode);
     }
 }
 
@@ -148,13 +175,13 @@ void Chip8CPU::handle_0XXX(uint16_t opcode)
     // Extract the fourth nibble to determine the specific 0XXX opcode
     uint8_t sub_opcode = opcode & 0x000F;
 
-    if (sub_opcode < _0_table.size())
+    if (sub_opcode < opcodeTables_._0_table.size())
     {
-        (this->*_0_table[sub_opcode])(opcode);
+        (this->*opcodeTables_._0_table[sub_opcode])(opcode);
     }
     else
     {
-        spdlog::error("Unknown 0XXX opcode: {:#04x}", opcode);
+        invalidOpcode(opcode);
     }
 }
 
@@ -164,13 +191,13 @@ void Chip8CPU::handle_8XXX(uint16_t opcode)
 
     uint8_t sub_opcode = opcode & 0x000F;
 
-    if (sub_opcode < _8_table.size())
+    if (sub_opcode < opcodeTables_._8_table.size())
     {
-        (this->*_8_table[sub_opcode])(opcode);
+        (this->*opcodeTables_._8_table[sub_opcode])(opcode);
     }
     else
     {
-        spdlog::error("Unknown 8XXX opcode: {:#04x}", opcode);
+        invalidOpcode(opcode);
     }
 }
 
@@ -181,13 +208,13 @@ void Chip8CPU::handle_EXXX(uint16_t opcode)
     // Extract the fourth nibble to determine the specific EXXX opcode
     uint8_t sub_opcode = opcode & 0x000F;
 
-    if (sub_opcode < _E_table.size())
+    if (sub_opcode < opcodeTables_._E_table.size())
     {
-        (this->*_E_table[sub_opcode])(opcode);
+        (this->*opcodeTables_._E_table[sub_opcode])(opcode);
     }
     else
     {
-        spdlog::error("Unknown EXXX opcode: {:#04x}", opcode);
+        invalidOpcode(opcode);
     }
 }
 
@@ -198,13 +225,13 @@ void Chip8CPU::handle_FXXX(uint16_t opcode)
     // Extract the fourth nibble to determine the specific FXXX opcode
     uint8_t sub_opcode = opcode & 0x00FF;
 
-    if (sub_opcode < _F_table.size())
+    if (sub_opcode < opcodeTables_._F_table.size())
     {
-        (this->*_F_table[sub_opcode])(opcode);
+        (this->*opcodeTables_._F_table[sub_opcode])(opcode);
     }
     else
     {
-        spdlog::error("Unknown FXXX opcode: {:#04x}", opcode);
+        invalidOpcode(opcode);
     }
 }
 
@@ -227,8 +254,10 @@ void Chip8CPU::opcode_00E0(uint16_t opcode)
 void Chip8CPU::opcode_00EE(uint16_t opcode)
 {
     spdlog::trace("Running Opcode: 00EE");
+    // The stack is a ring of 16 levels: a return with nothing on it takes the
+    // oldest slot and leaves SP at 15 instead of running off the array
     this->PC_ = this->stack_[this->SP_];
-    this->SP_--;
+    this->SP_ = (this->SP_ - 1) & 0xF;
 }
 
 /**
@@ -254,7 +283,7 @@ void Chip8CPU::opcode_2NNN(uint16_t opcode)
 {
     spdlog::trace("Running Opcode: 2NNN");
     uint16_t address = opcode & 0x0FFF;
-    this->SP_++;
+    this->SP_               = (this->SP_ + 1) & 0xF; // A 17th nested call overwrites the oldest
     this->stack_[this->SP_] = this->PC_;
     this->PC_               = address;
 }
@@ -541,7 +570,7 @@ void Chip8CPU::opcode_CXKK(uint16_t opcode)
     spdlog::trace("Running Opcode: CXKK");
     uint8_t x  = this->getNibble(opcode, 2);
     uint8_t kk = opcode & 0x00FF;
-    this->setV(x, (rand() % 256) & kk);
+    this->setV(x, random_.next() & kk);
 }
 
 /**
@@ -559,36 +588,17 @@ void Chip8CPU::opcode_CXKK(uint16_t opcode)
 void Chip8CPU::opcode_DXYN(uint16_t opcode)
 {
     spdlog::trace("Running Opcode: DXYN");
-    uint8_t x = this->getNibble(opcode, 2);
-    uint8_t y = this->getNibble(opcode, 1);
-    uint8_t n = this->getNibble(opcode, 0);
-    setV(0xF, 0); // Clear VF before drawing
+    uint8_t x         = this->getV(this->getNibble(opcode, 2));
+    uint8_t y         = this->getV(this->getNibble(opcode, 1));
+    uint8_t n         = this->getNibble(opcode, 0);
+    bool    collision = false;
 
     for (int i = 0; i < n; ++i)
     {
-        uint8_t     sprite      = memory_.read(I_ + i);
-        std::string sprite_bits = std::bitset<8>(sprite).to_string();
-        for (int j = 0; j < 8; ++j)
-        {
-            // Calculate pixel position
-            int pixel_x = (getV(x) + j) % graphics_.FRAMEBUFFER_WIDTH;
-            int pixel_y = (getV(y) + i) % graphics_.FRAMEBUFFER_HEIGHT;
-
-            // Check if the pixel is set
-            if ((sprite & (0x80 >> j)) != 0)
-            {
-                // If the pixel is already set, set VF to 1
-                if (graphics_.getPixel(pixel_x, pixel_y))
-                {
-                    graphics_.setPixel(pixel_x, pixel_y, false); // Erase the pixel
-                    setV(0xF, 1);
-                    continue;
-                }
-                // Draw the pixel
-                graphics_.setPixel(pixel_x, pixel_y, true);
-            }
-        }
+        // Each sprite byte is XORed into one packed framebuffer row at once
+        collision |= graphics_.drawSpriteRow(x, y + i, memory_.read(I_ + i));
     }
+    setV(0xF, collision ? 1 : 0);
 }
 
 /**
@@ -624,6 +634,23 @@ void Chip8CPU::opcode_EXA1(uint16_t opcode)
     }
 }
 
+/**
+ * F002: AUDIO - Load the XO-CHIP audio pattern
+ *
+ * The 16 bytes at I become the 128 1-bit samples the buzzer loops while the
+ * sound timer is active, replacing the classic tone.
+ */
+void Chip8CPU::opcode_F002(uint16_t opcode)
+{
+    spdlog::trace("Running Opcode: F002");
+    for (int i = 0; i < AUDIO_PATTERN_SIZE; ++i)
+    {
+        audioPattern_[i] = memory_.read(this->getI() + i);
+    }
+    hasAudioPattern_ = true;
+    ++audioGeneration_;
+}
+
 /**
  * FX07: LD Vx, DT - Set Vx = delay timer value
  *
@@ -645,21 +672,20 @@ void Chip8CPU::opcode_FX07(uint16_t opcode)
 void Chip8CPU::opcode_FX0A(uint16_t opcode)
 {
     spdlog::trace("Running Opcode: FX0A");
-    uint8_t x          = this->getNibble(opcode, 2);
-    bool    keyPressed = false;
-    for (int i = 0; i < 16; ++i)
+    uint8_t  x        = this->getNibble(opcode, 2);
+    uint16_t released = input_.getReleasedKeys();
+    if (released == 0)
     {
-        if (input_.wasKeyReleased(i))
-        {
-            this->setV(x, i);
-            keyPressed = true;
-            break;
-        }
+        this->PC_ -= 2;
+        return;
     }
-    if (!keyPressed)
+    // The lowest released key wins if several were released at once
+    uint8_t key = 0;
+    while (((released >> key) & 1) == 0)
     {
-        this->PC_ -= 2;
+        ++key;
     }
+    this->setV(x, key);
 }
 
 /**
@@ -727,6 +753,19 @@ void Chip8CPU::opcode_FX33(uint16_t opcode)
     memory_.write(this->getI() + 2, value % 10);
 }
 
+/**
+ * FX3A: PITCH Vx - Set the XO-CHIP pitch register = Vx
+ *
+ * The audio pattern plays at 4000 * 2^((Vx - 64) / 48) bits per second.
+ */
+void Chip8CPU::opcode_FX3A(uint16_t opcode)
+{
+    spdlog::trace("Running Opcode: FX3A");
+    uint8_t x = this->getNibble(opcode, 2);
+    pitch_    = this->getV(x);
+    ++audioGeneration_;
+}
+
 /**
  * FX55: LD [I], Vx - Store registers V0 through Vx in memory
  *
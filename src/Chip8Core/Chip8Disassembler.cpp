@@ -0,0 +1,102 @@
+#include "Chip8Core/Chip8Disassembler.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include "Chip8Core/Chip8Memory.h"
+
+namespace chip8core
+{
+std::string Chip8Disassembler::disassemble(uint16_t opcode)
+{
+    unsigned x   = (opcode >> 8) & 0xF;
+    unsigned y   = (opcode >> 4) & 0xF;
+    unsigned n   = opcode & 0xF;
+    unsigned kk  = opcode & 0xFF;
+    unsigned nnn = opcode & 0xFFF;
+
+    switch (opcode >> 12)
+    {
+    case 0x0:
+        // Chip8CPU decodes 0x0 opcodes by their low nibble only
+        if (n == 0x0)
+            return "CLS";
+        if (n == 0xE)
+            return "RET";
+        break;
+    case 0x1:
+        return fmt::format("JP 0x{:03X}", nnn);
+    case 0x2:
+        return fmt::format("CALL 0x{:03X}", nnn);
+    case 0x3:
+        return fmt::format("SE V{:X}, 0x{:02X}", x, kk);
+    case 0x4:
+        return fmt::format("SNE V{:X}, 0x{:02X}", x, kk);
+    case 0x5:
+        return fmt::format("SE V{:X}, V{:X}", x, y);
+    case 0x6:
+        return fmt::format("LD V{:X}, 0x{:02X}", x, kk);
+    case 0x7:
+        return fmt::format("ADD V{:X}, 0x{:02X}", x, kk);
+    case 0x8:
+    {
+        static const char* const ALU[] = {"LD", "OR", "AND", "XOR", "ADD", "SUB", "SHR", "SUBN"};
+        if (n <= 0x7)
+            return fmt::format("{} V{:X}, V{:X}", ALU[n], x, y);
+        if (n == 0xE)
+            return fmt::format("SHL V{:X}, V{:X}", x, y);
+        break;
+    }
+    case 0x9:
+        return fmt::format("SNE V{:X}, V{:X}", x, y);
+    case 0xA:
+        return fmt::format("LD I, 0x{:03X}", nnn);
+    case 0xB:
+        return fmt::format("JP V0, 0x{:03X}", nnn);
+    case 0xC:
+        return fmt::format("RND V{:X}, 0x{:02X}", x, kk);
+    case 0xD:
+        return fmt::format("DRW V{:X}, V{:X}, {}", x, y, n);
+    case 0xE:
+        if (n == 0xE)
+            return fmt::format("SKP V{:X}", x);
+        if (n == 0x1)
+            return fmt::format("SKNP V{:X}", x);
+        break;
+    case 0xF:
+        switch (kk)
+        {
+        case 0x02:
+            return "AUDIO"; // F002, decoded by its low byte like the rest
+        case 0x07:
+            return fmt::format("LD V{:X}, DT", x);
+        case 0x0A:
+            return fmt::format("LD V{:X}, K", x);
+        case 0x15:
+            return fmt::format("LD DT, V{:X}", x);
+        case 0x18:
+            return fmt::format("LD ST, V{:X}", x);
+        case 0x1E:
+            return fmt::format("ADD I, V{:X}", x);
+        case 0x29:
+            return fmt::format("LD F, V{:X}", x);
+        case 0x33:
+            return fmt::format("LD B, V{:X}", x);
+        case 0x3A:
+            return fmt::format("PITCH V{:X}", x);
+        case 0x55:
+            return fmt::format("LD [I], V{:X}", x);
+        case 0x65:
+            return fmt::format("LD V{:X}, [I]", x);
+        }
+        break;
+    }
+    return fmt::format("DW 0x{:04X}", opcode);
+}
+
+std::string Chip8Disassembler::disassembleAt(const uint8_t* memory, uint16_t address)
+{
+    constexpr uint16_t MASK   = Chip8Memory::MEMORY_SIZE - 1;
+    uint16_t           opcode = memory[address & MASK] << 8 | memory[(address + 1) & MASK];
+    return fmt::format("0x{:03X}: {:04X}  {}", address & MASK, opcode, disassemble(opcode));
+}
+} // namespace chip8core
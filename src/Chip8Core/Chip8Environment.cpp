@@ -0,0 +1,45 @@
+#include "Chip8Core/Chip8Environment.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cstring>
+
+namespace chip8core
+{
+Chip8Environment::Chip8Environment(std::vector<uint8_t> rom, int cyclesPerFrame)
+    : rom_(std::move(rom)), cyclesPerFrame_(cyclesPerFrame), observation_()
+{
+    reset(1);
+    spdlog::debug("Chip8 Environment created");
+}
+
+const Chip8Observation& Chip8Environment::reset(uint32_t seed)
+{
+    machine_.setSeed(seed);
+    machine_.reset();
+    machine_.loadROM(rom_.data(), rom_.size());
+    machine_.getInput().setKeyMask(0);
+    machine_.getInput().syncKeyStates();
+    observe();
+    return observation_;
+}
+
+const Chip8Observation& Chip8Environment::step(uint16_t keyMask, int frames)
+{
+    machine_.getInput().setKeyMask(keyMask);
+    for (int i = 0; i < frames; ++i)
+    {
+        machine_.runFrame(cyclesPerFrame_);
+    }
+    observe();
+    return observation_;
+}
+
+void Chip8Environment::observe()
+{
+    std::memcpy(observation_.framebuffer, machine_.getGraphics().data(),
+                sizeof(observation_.framebuffer));
+    observation_.soundOn = machine_.getSoundTimer().getValue() > 0;
+    observation_.reward  = rewardProbe_ ? rewardProbe_(machine_) : 0.0f;
+}
+} // namespace chip8core
@@ -0,0 +1,192 @@
+#include "Chip8Core/Chip8Farm.h"
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include "Chip8Core/Chip8.h"
+
+namespace chip8core
+{
+Chip8Farm::Chip8Farm(Chip8FarmOptions options) : options_(options)
+{
+    options_.checkpointEvery = std::max(1, options_.checkpointEvery);
+}
+
+Chip8FarmResult Chip8Farm::runJob(const Chip8FarmJob& job) const
+{
+    Chip8FarmResult result;
+    result.name = job.name;
+
+    auto machine    = std::make_unique<Chip8>();
+    auto checkpoint = [&](int frame, bool last)
+    {
+        // A machine that hit an invalid opcode has left the ROM's code; stop rather than hash it
+        const Chip8CPU& cpu = machine->getCPU();
+        if (cpu.getInvalidOpcodeCount() > 0)
+        {
+            uint16_t pc  = cpu.getFaultPC();
+            result.error = fmt::format("faulted in frame {}: invalid opcode {:02X}{:02X} at {:03X}",
+                                       frame, machine->getMemory().read(pc),
+                                       machine->getMemory().read(pc + 1), pc);
+            return false;
+        }
+        if (frame % options_.checkpointEvery == 0 || last)
+        {
+            result.frames.push_back(frame);
+            result.hashes.push_back(machine->getGraphics().getHash());
+        }
+        return true;
+    };
+
+    try
+    {
+        if (job.movie.length > 0)
+        {
+            Chip8MoviePlayer player(job.movie);
+            player.start(*machine, job.rom.data(), job.rom.size());
+            for (int frame = 1; !player.isFinished(*machine); ++frame)
+            {
+                uint64_t frameEnd =
+                    static_cast<uint64_t>(frame) * job.movie.cpuHz / Chip8::TIMER_HZ;
+                player.advance(*machine, frameEnd - machine->getCycleCount());
+                if (!checkpoint(frame, player.isFinished(*machine)))
+                {
+                    break;
+                }
+            }
+            return result;
+        }
+
+        machine->setSeed(options_.seed);
+        machine->reset();
+        machine->loadROM(job.rom.data(), job.rom.size());
+        size_t nextEvent = 0;
+        for (int frame = 1; frame <= options_.frames; ++frame)
+        {
+            while (nextEvent < job.input.size() && job.input[nextEvent].frame < frame)
+            {
+                machine->getInput().setKeyMask(job.input[nextEvent++].keyMask);
+            }
+            machine->runFrame(options_.cyclesPerFrame);
+            if (!checkpoint(frame, frame == options_.frames))
+            {
+                break;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        result.error = e.what();
+    }
+    return result;
+}
+
+std::vector<Chip8FarmResult> Chip8Farm::run(const std::vector<Chip8FarmJob>& jobs) const
+{
+    std::vector<Chip8FarmResult> results(jobs.size());
+    std::atomic<size_t>          next{0};
+
+    auto worker = [&]()
+    {
+        for (size_t job = next.fetch_add(1); job < jobs.size(); job = next.fetch_add(1))
+        {
+            results[job] = runJob(jobs[job]);
+        }
+    };
+
+    size_t threads = options_.threads;
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, std::max<size_t>(jobs.size(), 1));
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threads; ++i)
+    {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers)
+    {
+        thread.join();
+    }
+    spdlog::debug("Chip8 Farm ran {} jobs on {} threads", jobs.size(), threads);
+    return results;
+}
+
+Chip8GoldenHashes Chip8Farm::readGolden(std::istream& in)
+{
+    Chip8GoldenHashes golden;
+    std::string       line;
+    while (std::getline(in, line))
+    {
+        std::istringstream fields(line.substr(0, line.find('#')));
+        std::string        name, hash;
+        int                frame;
+        if (fields >> name >> frame >> hash)
+        {
+            golden[name][frame] = std::stoull(hash, nullptr, 16);
+        }
+    }
+    return golden;
+}
+
+void Chip8Farm::writeGolden(std::ostream& out, const std::vector<Chip8FarmResult>& results)
+{
+    for (const Chip8FarmResult& result : results)
+    {
+        if (!result.error.empty())
+        {
+            continue; // Never pin a crashed machine as golden
+        }
+        for (size_t i = 0; i < result.hashes.size(); ++i)
+        {
+            out << fmt::format("{} {} {:016x}\n", result.name, result.frames[i], result.hashes[i]);
+        }
+    }
+}
+
+std::vector<std::string> Chip8Farm::compare(const Chip8FarmResult&   result,
+                                            const Chip8GoldenHashes& golden)
+{
+    std::vector<std::string> mismatches;
+    auto                     expected = golden.find(result.name);
+    if (expected == golden.end())
+    {
+        mismatches.push_back("no golden hashes");
+        return mismatches;
+    }
+
+    for (size_t i = 0; i < result.hashes.size(); ++i)
+    {
+        auto hash = expected->second.find(result.frames[i]);
+        if (hash == expected->second.end())
+        {
+            mismatches.push_back(fmt::format("frame {}: no golden hash", result.frames[i]));
+        }
+        else if (hash->second != result.hashes[i])
+        {
+            mismatches.push_back(fmt::format("frame {}: hash {:016x}, expected {:016x}",
+                                             result.frames[i], result.hashes[i], hash->second));
+        }
+    }
+    for (const auto& checkpoint : expected->second)
+    {
+        if (std::find(result.frames.begin(), result.frames.end(), checkpoint.first) ==
+            result.frames.end())
+        {
+            std::string reason = result.error.empty() ? "" : " (" + result.error + ")";
+            mismatches.push_back(fmt::format("frame {}: not reached{}", checkpoint.first, reason));
+        }
+    }
+    return mismatches;
+}
+} // namespace chip8core
@@ -0,0 +1,156 @@
+#include "Chip8Core/Chip8FrameExporter.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace chip8core
+{
+namespace
+{
+// Expands a byte of 8 pixels into 8 bytes of 0x00/0x01, leftmost pixel in the lowest byte.
+// Stored with memcpy, this puts the leftmost pixel first on little-endian hosts (x86, ARM, WASM).
+constexpr std::array<uint64_t, 256> makeExpandTable()
+{
+    std::array<uint64_t, 256> table{};
+    for (int value = 0; value < 256; ++value)
+    {
+        uint64_t expanded = 0;
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            if (value & (0x80 >> bit))
+            {
+                expanded |= 1ULL << (bit * 8);
+            }
+        }
+        table[value] = expanded;
+    }
+    return table;
+}
+
+constexpr std::array<uint64_t, 256> EXPAND_TABLE = makeExpandTable();
+} // namespace
+
+Chip8FrameExporter::Chip8FrameExporter(size_t machines, Chip8FrameExportOptions options)
+    : machines_(machines), options_(options)
+{
+    options_.stack = std::max(1, options_.stack);
+    historyLength_ = options_.stack + 1;
+    history_.resize(machines_ * historyLength_ * ROW_COUNT);
+    hashes_.resize(machines_ * historyLength_);
+    head_.resize(machines_);
+    reset();
+    spdlog::debug("Chip8 Frame Exporter created for {} machines", machines_);
+}
+
+void Chip8FrameExporter::reset()
+{
+    std::fill(history_.begin(), history_.end(), 0);
+    std::fill(hashes_.begin(), hashes_.end(), Chip8GraphicsBuffer().getHash());
+    std::fill(head_.begin(), head_.end(), 0);
+}
+
+size_t Chip8FrameExporter::frameSize(Chip8FrameFormat format)
+{
+    constexpr size_t WIDTH = Chip8GraphicsBuffer::FRAMEBUFFER_WIDTH;
+    return format == Chip8FrameFormat::Bytes ? ROW_COUNT * WIDTH : ROW_COUNT * WIDTH / 8;
+}
+
+void Chip8FrameExporter::capture(size_t machine, const uint64_t* rows)
+{
+    capture(machine, rows, Chip8GraphicsBuffer::hashRows(rows));
+}
+
+void Chip8FrameExporter::capture(size_t machine, const Chip8GraphicsBuffer& graphics)
+{
+    capture(machine, graphics.data(), graphics.getHash());
+}
+
+void Chip8FrameExporter::capture(size_t machine, const uint64_t* rows, uint64_t hash)
+{
+    size_t slot    = (head_[machine] + 1) % historyLength_;
+    head_[machine] = slot;
+    std::memcpy(&history_[(machine * historyLength_ + slot) * ROW_COUNT], rows,
+                ROW_COUNT * sizeof(uint64_t));
+    hashes_[machine * historyLength_ + slot] = hash;
+}
+
+void Chip8FrameExporter::capture(const Chip8Batch& batch)
+{
+    size_t lanes = std::min(batch.size(), machines_);
+    for (size_t lane = 0; lane < lanes; ++lane)
+    {
+        capture(lane, batch.getFrameBuffer(lane));
+    }
+}
+
+bool Chip8FrameExporter::isRepeat(size_t machine) const
+{
+    return getFrameHash(machine, 0) == getFrameHash(machine, 1);
+}
+
+uint64_t Chip8FrameExporter::getFrameHash(size_t machine, size_t age) const
+{
+    return hashes_[machine * historyLength_ + historySlot(machine, age)];
+}
+
+size_t Chip8FrameExporter::historySlot(size_t machine, size_t age) const
+{
+    return (head_[machine] + historyLength_ - age) % historyLength_;
+}
+
+const uint64_t* Chip8FrameExporter::historyFrame(size_t machine, size_t age) const
+{
+    return &history_[(machine * historyLength_ + historySlot(machine, age)) * ROW_COUNT];
+}
+
+void Chip8FrameExporter::exportTo(uint8_t* out) const
+{
+    size_t   frameBytes = getFrameSize();
+    uint64_t pooled[ROW_COUNT];
+
+    for (size_t machine = 0; machine < machines_; ++machine)
+    {
+        // Oldest frame first, so the last frame of each stack is the current one
+        for (int age = options_.stack - 1; age >= 0; --age)
+        {
+            const uint64_t* rows = historyFrame(machine, age);
+            if (options_.maxPool)
+            {
+                const uint64_t* previous = historyFrame(machine, age + 1);
+                for (size_t row = 0; row < ROW_COUNT; ++row)
+                {
+                    pooled[row] = rows[row] | previous[row];
+                }
+                rows = pooled;
+            }
+            writeFrame(rows, options_.format, options_.pixelOn, out);
+            out += frameBytes;
+        }
+    }
+}
+
+void Chip8FrameExporter::writeFrame(const uint64_t* rows, Chip8FrameFormat format,
+                                    uint8_t pixelOn, uint8_t* out)
+{
+    for (size_t row = 0; row < ROW_COUNT; ++row)
+    {
+        uint64_t bits = rows[row];
+        for (int byte = 0; byte < 8; ++byte)
+        {
+            uint8_t pixels = static_cast<uint8_t>(bits >> (56 - byte * 8));
+            if (format == Chip8FrameFormat::BitPacked)
+            {
+                *out++ = pixels;
+                continue;
+            }
+            // 0x01 bytes times pixelOn cannot carry between bytes
+            uint64_t expanded = EXPAND_TABLE[pixels] * pixelOn;
+            std::memcpy(out, &expanded, sizeof(expanded));
+            out += sizeof(expanded);
+        }
+    }
+}
+} // namespace chip8core
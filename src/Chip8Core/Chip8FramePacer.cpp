@@ -0,0 +1,138 @@
+#include "Chip8Core/Chip8FramePacer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "Chip8Core/Chip8.h"
+
+namespace chip8core
+{
+namespace
+{
+constexpr uint64_t NS_PER_SECOND = 1000000000;
+}
+
+Chip8FramePacer::Chip8FramePacer(double refreshHz)
+{
+    setRefreshRate(refreshHz);
+}
+
+void Chip8FramePacer::setRefreshRate(double refreshHz)
+{
+    refreshHz = std::max(refreshHz, 1.0);
+    periodNs_ = static_cast<uint64_t>(NS_PER_SECOND / refreshHz);
+}
+
+uint64_t Chip8FramePacer::beginFrame(uint64_t nowNs, Chip8Stats& stats)
+{
+    if (deadline_ == 0)
+    {
+        deadline_ = nowNs;
+    }
+
+    // One frame, plus every whole period missed since the deadline
+    uint64_t frames = 1;
+    if (nowNs > deadline_)
+    {
+        frames += (nowNs - deadline_) / periodNs_;
+    }
+    deadline_ += frames * periodNs_;
+
+    if (frames > MAX_CATCH_UP_FRAMES)
+    {
+        uint64_t dropped = frames - MAX_CATCH_UP_FRAMES;
+        droppedFrames_ += dropped;
+        stats.cyclesDropped += static_cast<uint64_t>(dropped * periodNs_ * 1e-9 * Chip8::CPU_HZ);
+        frames = MAX_CATCH_UP_FRAMES;
+    }
+    alignToVsync();
+    return takeCycles(frames * periodNs_);
+}
+
+uint64_t Chip8FramePacer::beginFrameAt(uint64_t timestampNs, Chip8Stats& stats)
+{
+    if (lastFrameNs_ == 0 || timestampNs <= lastFrameNs_)
+    {
+        // Start, resume or a repeated timestamp: nothing is owed yet
+        lastFrameNs_ = timestampNs == 0 ? 1 : timestampNs;
+        return 0;
+    }
+
+    uint64_t elapsed = timestampNs - lastFrameNs_;
+    lastFrameNs_     = timestampNs;
+    trackInterval(elapsed);
+
+    // Run the time since the last vsync, dropping what exceeds the catch-up cap
+    uint64_t cap = MAX_CATCH_UP_FRAMES * periodNs_;
+    if (elapsed > cap)
+    {
+        uint64_t dropped = elapsed - cap;
+        droppedFrames_ += dropped / periodNs_;
+        stats.cyclesDropped += dropped * Chip8::CPU_HZ / NS_PER_SECOND;
+        elapsed = cap;
+    }
+    return takeCycles(elapsed);
+}
+
+void Chip8FramePacer::trackInterval(uint64_t intervalNs)
+{
+    if (intervalNs > MAX_INTERVAL_NS)
+    {
+        return;
+    }
+    intervalsNs_[intervalCount_++ % REFRESH_WINDOW] = intervalNs;
+
+    // The median ignores the odd late or doubled frame
+    uint64_t sorted[REFRESH_WINDOW];
+    size_t   count = std::min(intervalCount_, REFRESH_WINDOW);
+    std::copy_n(intervalsNs_, count, sorted);
+    std::nth_element(sorted, sorted + count / 2, sorted + count);
+    periodNs_ = std::max<uint64_t>(sorted[count / 2], 1);
+}
+
+uint64_t Chip8FramePacer::takeCycles(uint64_t frameNs)
+{
+    // Carry the fraction of a cycle, so 700Hz divides into any refresh rate exactly
+    uint64_t owed  = cycleFraction_ + frameNs * Chip8::CPU_HZ;
+    cycleFraction_ = owed % NS_PER_SECOND;
+    return owed / NS_PER_SECOND;
+}
+
+void Chip8FramePacer::alignToVsync()
+{
+    uint64_t vsync = vsyncNs_.load(std::memory_order_relaxed);
+    if (vsync <= LEAD_NS)
+    {
+        return;
+    }
+
+    // Move the deadline by less than half a period onto the grid of vsyncs minus LEAD_NS
+    uint64_t target = vsync - LEAD_NS;
+    uint64_t offset = deadline_ >= target ? (deadline_ - target) % periodNs_
+                                          : periodNs_ - (target - deadline_) % periodNs_;
+    offset %= periodNs_;
+    if (offset > periodNs_ / 2)
+    {
+        deadline_ += periodNs_ - offset;
+    }
+    else
+    {
+        deadline_ -= offset;
+    }
+}
+
+void Chip8FramePacer::sleepUntil(uint64_t deadlineNs)
+{
+    // Sleep through most of the wait; the OS may oversleep by up to a millisecond or so
+    uint64_t now = Chip8Stats::now();
+    if (deadlineNs > now + SPIN_NS)
+    {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(deadlineNs - now - SPIN_NS));
+    }
+    while (Chip8Stats::now() < deadlineNs)
+    {
+        std::this_thread::yield();
+    }
+}
+} // namespace chip8core
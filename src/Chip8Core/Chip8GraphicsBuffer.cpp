@@ -4,6 +4,31 @@
 #include <iostream>
 namespace chip8core
 {
+namespace
+{
+// splitmix64 finalizer over the row salted with its index, so equal rows at
+// different heights hash differently
+constexpr uint64_t hashRow(uint64_t row, int y)
+{
+    uint64_t h = row + (static_cast<uint64_t>(y) + 1) * 0x9E3779B97F4A7C15ULL;
+    h          = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h          = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    return h ^ (h >> 31);
+}
+
+constexpr uint64_t hashEmpty()
+{
+    uint64_t hash = 0;
+    for (int y = 0; y < Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT; ++y)
+    {
+        hash ^= hashRow(0, y);
+    }
+    return hash;
+}
+
+constexpr uint64_t EMPTY_HASH = hashEmpty();
+} // namespace
+
 Chip8GraphicsBuffer::Chip8GraphicsBuffer()
 {
     clear();
@@ -15,7 +40,8 @@ Chip8GraphicsBuffer::~Chip8GraphicsBuffer()
 
 void Chip8GraphicsBuffer::clear()
 {
-    std::memset(framebuffer_, 0, sizeof(framebuffer_));
+    std::memset(rows_, 0, sizeof(rows_));
+    hash_ = EMPTY_HASH;
 }
 
 void Chip8GraphicsBuffer::setPixel(int x, int y, bool value)
@@ -25,10 +51,13 @@ void Chip8GraphicsBuffer::setPixel(int x, int y, bool value)
         throw Chip8GraphicsError(Chip8GraphicsError::OUT_OF_BOUNDS);
     }
 
-    if (value)
-        framebuffer_[y * FRAMEBUFFER_WIDTH + x] |= 0xFFFFFFFF;
-    else
-        framebuffer_[y * FRAMEBUFFER_WIDTH + x] &= 0x00000000;
+    uint64_t mask = 1ULL << (FRAMEBUFFER_WIDTH - 1 - x);
+    uint64_t row  = value ? rows_[y] | mask : rows_[y] & ~mask;
+    if (row != rows_[y])
+    {
+        hash_ ^= hashRow(rows_[y], y) ^ hashRow(row, y);
+        rows_[y] = row;
+    }
 }
 
 bool Chip8GraphicsBuffer::getPixel(int x, int y) const
@@ -38,13 +67,41 @@ bool Chip8GraphicsBuffer::getPixel(int x, int y) const
         throw Chip8GraphicsError(Chip8GraphicsError::OUT_OF_BOUNDS);
     }
 
-    return framebuffer_[y * FRAMEBUFFER_WIDTH + x] != 0;
+    return (rows_[y] >> (FRAMEBUFFER_WIDTH - 1 - x)) & 1;
 }
 
 std::vector<uint32_t> Chip8GraphicsBuffer::dumpFrameBuffer() const
 {
-    return std::vector<uint32_t>(framebuffer_,
-                                 framebuffer_ + sizeof(framebuffer_) / sizeof(uint32_t));
+    std::vector<uint32_t> pixels(FRAMEBUFFER_WIDTH * FRAMEBUFFER_HEIGHT);
+    for (int y = 0; y < FRAMEBUFFER_HEIGHT; ++y)
+    {
+        for (int x = 0; x < FRAMEBUFFER_WIDTH; ++x)
+        {
+            pixels[y * FRAMEBUFFER_WIDTH + x] = getPixel(x, y) ? 0xFFFFFFFF : 0x00000000;
+        }
+    }
+    return pixels;
+}
+
+bool Chip8GraphicsBuffer::drawSpriteRow(int x, int y, uint8_t sprite)
+{
+    // Place the sprite in the top byte, then rotate right so bits past column 63 wrap to column 0
+    unsigned shift = static_cast<unsigned>(x) % FRAMEBUFFER_WIDTH;
+    uint64_t line  = static_cast<uint64_t>(sprite) << (FRAMEBUFFER_WIDTH - 8);
+    if (shift != 0)
+    {
+        line = (line >> shift) | (line << (FRAMEBUFFER_WIDTH - shift));
+    }
+
+    int       wrappedY  = static_cast<int>(static_cast<unsigned>(y) % FRAMEBUFFER_HEIGHT);
+    uint64_t& row       = rows_[wrappedY];
+    bool      collision = (row & line) != 0;
+    if (line != 0)
+    {
+        hash_ ^= hashRow(row, wrappedY) ^ hashRow(row ^ line, wrappedY);
+        row ^= line;
+    }
+    return collision;
 }
 
 void Chip8GraphicsBuffer::printScreen() const
@@ -58,4 +115,14 @@ void Chip8GraphicsBuffer::printScreen() const
         std::cout << std::endl;
     }
 }
-} // namespace chip8core
\ No newline at end of file
+
+uint64_t Chip8GraphicsBuffer::hashRows(const uint64_t* rows)
+{
+    uint64_t hash = 0;
+    for (int y = 0; y < FRAMEBUFFER_HEIGHT; ++y)
+    {
+        hash ^= hashRow(rows[y], y);
+    }
+    return hash;
+}
+} // namespace chip8core
@@ -2,36 +2,24 @@
 
 namespace chip8core
 {
-Chip8InputBuffer::Chip8InputBuffer()
-{
-    for (int i = 0; i < 16; ++i)
-    {
-        keyStates[i] = false;
-    }
-}
+Chip8InputBuffer::Chip8InputBuffer() = default;
 
 Chip8InputBuffer::~Chip8InputBuffer() = default;
 
-void Chip8InputBuffer::syncKeyStates()
-{
-    for (int i = 0; i < 16; ++i)
-        prevKeyStates[i] = keyStates[i];
-}
-
 void Chip8InputBuffer::setKeyState(uint8_t key, bool pressed)
 {
-    if (key >= 0 && key < 16)
+    if (key < 16)
     {
-        keyStates[key] = pressed;
+        uint16_t bit = static_cast<uint16_t>(1u << key);
+        keys_        = pressed ? (keys_ | bit) : (keys_ & ~bit);
     }
 }
 
 bool Chip8InputBuffer::getKeyState(uint8_t key) const
 {
-
-    if (key >= 0 && key < 16)
+    if (key < 16)
     {
-        return keyStates[key];
+        return (keys_ >> key) & 1;
     }
     return false;
 }
@@ -39,7 +27,7 @@ bool Chip8InputBuffer::getKeyState(uint8_t key) const
 bool Chip8InputBuffer::wasKeyReleased(uint8_t key) const
 {
     if (key < 16)
-        return prevKeyStates[key] && !keyStates[key];
+        return (getReleasedKeys() >> key) & 1;
     return false;
 }
-} // namespace chip8core
\ No newline at end of file
+} // namespace chip8core
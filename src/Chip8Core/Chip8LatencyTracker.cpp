@@ -0,0 +1,61 @@
+#include "Chip8Core/Chip8LatencyTracker.h"
+
+#include <iomanip>
+
+namespace chip8core
+{
+Chip8LatencyTracker::Chip8LatencyTracker()
+{
+    reset();
+}
+
+void Chip8LatencyTracker::reset()
+{
+    previousHash_ = Chip8GraphicsBuffer().getHash();
+    pending_     = false;
+    transitions_ = 0;
+    unanswered_  = 0;
+    latency_.reset();
+}
+
+void Chip8LatencyTracker::onKeyTransition(uint64_t timestampNs)
+{
+    ++transitions_;
+    // Latency is measured from the oldest transition still waiting for a response
+    if (!pending_)
+    {
+        pending_      = true;
+        pendingSince_ = timestampNs;
+    }
+}
+
+void Chip8LatencyTracker::onFrame(const Chip8GraphicsBuffer& graphics, uint64_t timestampNs)
+{
+    bool changed  = !graphics.isSameFrame(previousHash_);
+    previousHash_ = graphics.getHash();
+
+    if (!pending_)
+    {
+        return;
+    }
+    uint64_t elapsed = timestampNs - pendingSince_;
+    if (changed)
+    {
+        latency_.record(elapsed);
+        pending_ = false;
+    }
+    else if (elapsed > TIMEOUT_NS)
+    {
+        ++unanswered_;
+        pending_ = false;
+    }
+}
+
+void Chip8LatencyTracker::dumpText(std::ostream& out) const
+{
+    out << "  Input latency p50 " << std::fixed << std::setprecision(2)
+        << latency_.percentile(0.5) / 1e6 << " ms  p99 " << latency_.percentile(0.99) / 1e6
+        << " ms  (" << latency_.getCount() << " of " << transitions_ << " key transitions, "
+        << unanswered_ << " unanswered)\n";
+}
+} // namespace chip8core
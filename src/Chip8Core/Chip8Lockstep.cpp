@@ -0,0 +1,279 @@
+#include "Chip8Core/Chip8Lockstep.h"
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+
+#include "Chip8Core/Chip8Disassembler.h"
+
+namespace chip8core
+{
+namespace
+{
+constexpr int FRAMEBUFFER_HEIGHT = Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT;
+constexpr int CONTEXT_AFTER      = 3; // Instructions disassembled after the reference PC
+
+std::string formatRegisters(const char* name, const Chip8MachineState& state)
+{
+    std::string line = fmt::format("  {:<10}", name);
+    for (int i = 0; i < 16; ++i)
+    {
+        line += fmt::format("V{:X}={:02X} ", i, state.V[i]);
+    }
+    line += fmt::format("I={:03X} PC={:03X} SP={:X} DT={:02X} ST={:02X}\n", state.I, state.PC,
+                        state.SP, state.delayTimer, state.soundTimer);
+    return line;
+}
+} // namespace
+
+void Chip8ReferenceEngine::reset(const std::vector<uint8_t>& rom, uint32_t seed)
+{
+    machine_.setSeed(seed);
+    machine_.reset();
+    machine_.loadROM(rom.data(), rom.size());
+    machine_.getInput().setKeyMask(0);
+}
+
+void Chip8ReferenceEngine::capture(Chip8MachineState& state) const
+{
+    const Chip8CPU& cpu = machine_.getCPU();
+    for (size_t i = 0; i < 16; ++i)
+    {
+        state.V[i]     = cpu.getV(i);
+        state.stack[i] = cpu.getStack(i);
+    }
+    state.I               = cpu.getI();
+    state.PC              = cpu.getPC();
+    state.SP              = static_cast<uint8_t>(cpu.getSP());
+    state.delayTimer      = machine_.getDelayTimer().getValue();
+    state.soundTimer      = machine_.getSoundTimer().getValue();
+    state.pitch           = cpu.getPitch();
+    state.hasAudioPattern = cpu.hasAudioPattern();
+    std::memcpy(state.audioPattern, cpu.getAudioPattern(), sizeof(state.audioPattern));
+    std::memcpy(state.framebuffer, machine_.getGraphics().data(), sizeof(state.framebuffer));
+    std::memcpy(state.memory, machine_.getMemory().data(), sizeof(state.memory));
+}
+
+void Chip8BatchEngine::reset(const std::vector<uint8_t>& rom, uint32_t seed)
+{
+    batch_.reset(seed);
+    batch_.loadROM(rom.data(), rom.size());
+    setKeys(0);
+}
+
+void Chip8BatchEngine::setKeys(uint16_t keyMask)
+{
+    for (size_t lane = 0; lane < batch_.size(); ++lane)
+    {
+        batch_.setKeys(lane, keyMask);
+    }
+}
+
+void Chip8BatchEngine::capture(Chip8MachineState& state) const
+{
+    for (size_t i = 0; i < 16; ++i)
+    {
+        state.V[i]     = batch_.getV(0, i);
+        state.stack[i] = batch_.getStack(0, i);
+    }
+    state.I               = batch_.getI(0);
+    state.PC              = batch_.getPC(0);
+    state.SP              = batch_.getSP(0);
+    state.delayTimer      = batch_.getDelayTimer(0);
+    state.soundTimer      = batch_.getSoundTimer(0);
+    state.pitch           = batch_.getPitch(0);
+    state.hasAudioPattern = batch_.hasAudioPattern(0);
+    std::memcpy(state.audioPattern, batch_.getAudioPattern(0), sizeof(state.audioPattern));
+    std::memcpy(state.framebuffer, batch_.getFrameBuffer(0), sizeof(state.framebuffer));
+    std::memcpy(state.memory, batch_.getMemory(0), sizeof(state.memory));
+}
+
+Chip8Lockstep::Chip8Lockstep(Chip8Engine& reference, Chip8Engine& candidate)
+    : reference_(reference), candidate_(candidate)
+{
+}
+
+std::string Chip8Lockstep::compare(const Chip8MachineState& a, const Chip8MachineState& b,
+                                   std::string* detail)
+{
+    auto differs = [detail](uint64_t x, uint64_t y, int width)
+    {
+        if (x != y && detail)
+        {
+            *detail = fmt::format("0x{:0{}X} vs 0x{:0{}X}", x, width, y, width);
+        }
+        return x != y;
+    };
+
+    if (differs(a.PC, b.PC, 3))
+        return "PC";
+    for (int i = 0; i < 16; ++i)
+    {
+        if (differs(a.V[i], b.V[i], 2))
+            return fmt::format("V{:X}", i);
+    }
+    if (differs(a.I, b.I, 3))
+        return "I";
+    if (differs(a.SP, b.SP, 2))
+        return "SP";
+    for (int i = 0; i < 16; ++i)
+    {
+        if (differs(a.stack[i], b.stack[i], 3))
+            return fmt::format("stack[{}]", i);
+    }
+    if (differs(a.delayTimer, b.delayTimer, 2))
+        return "DT";
+    if (differs(a.soundTimer, b.soundTimer, 2))
+        return "ST";
+    if (differs(a.pitch, b.pitch, 2))
+        return "pitch";
+    if (differs(a.hasAudioPattern, b.hasAudioPattern, 1))
+        return "hasAudioPattern";
+    for (int i = 0; i < Chip8CPU::AUDIO_PATTERN_SIZE; ++i)
+    {
+        if (differs(a.audioPattern[i], b.audioPattern[i], 2))
+            return fmt::format("audioPattern[{}]", i);
+    }
+    for (int row = 0; row < FRAMEBUFFER_HEIGHT; ++row)
+    {
+        if (differs(a.framebuffer[row], b.framebuffer[row], 16))
+            return fmt::format("framebuffer row {}", row);
+    }
+    if (std::memcmp(a.memory, b.memory, sizeof(a.memory)) != 0)
+    {
+        for (int address = 0; address < Chip8Memory::MEMORY_SIZE; ++address)
+        {
+            if (differs(a.memory[address], b.memory[address], 2))
+                return fmt::format("memory[0x{:03X}]", address);
+        }
+    }
+    return std::string();
+}
+
+Chip8InputScript Chip8Lockstep::tapEveryKey(int frames, int period, int holdFrames)
+{
+    Chip8InputScript script;
+    int              key = 0;
+    for (int frame = period; frame < frames; frame += period)
+    {
+        script.push_back({frame, static_cast<uint16_t>(1u << key)});
+        script.push_back({frame + holdFrames, 0});
+        key = (key + 1) % 16;
+    }
+    return script;
+}
+
+Chip8Divergence Chip8Lockstep::run(const std::vector<uint8_t>& rom,
+                                   const Chip8LockstepOptions& options)
+{
+    Chip8Divergence divergence;
+    historyCount_ = 0;
+    reference_.reset(rom, options.seed);
+    candidate_.reset(rom, options.seed);
+
+    // States differ only if the engines disagree, so compare at the start as well
+    reference_.capture(referenceState_);
+    candidate_.capture(candidateState_);
+    std::string detail;
+    std::string field = compare(referenceState_, candidateState_, &detail);
+    if (!field.empty())
+    {
+        fail(divergence, field, detail);
+        return divergence;
+    }
+
+    size_t nextEvent = 0;
+    for (int frame = 0; frame < options.frames; ++frame)
+    {
+        divergence.frame = frame;
+        while (nextEvent < options.input.size() && options.input[nextEvent].frame <= frame)
+        {
+            reference_.setKeys(options.input[nextEvent].keyMask);
+            candidate_.setKeys(options.input[nextEvent].keyMask);
+            ++nextEvent;
+        }
+
+        for (int cycle = 0; cycle <= options.cyclesPerFrame; ++cycle)
+        {
+            bool timerTick = cycle == options.cyclesPerFrame;
+            if (!timerTick)
+            {
+                history_[historyCount_++ % HISTORY_LENGTH] = reference_.getPC();
+            }
+            for (Chip8Engine* engine : {&reference_, &candidate_})
+            {
+                try
+                {
+                    timerTick ? engine->updateTimers() : engine->step();
+                }
+                catch (const std::exception& e)
+                {
+                    fail(divergence, "fault", fmt::format("{} raised: {}", engine->getName(),
+                                                          e.what()));
+                    return divergence;
+                }
+            }
+            if (!timerTick)
+            {
+                ++divergence.instructions;
+            }
+
+            if (timerTick || options.mode == Chip8LockstepMode::Instruction)
+            {
+                reference_.capture(referenceState_);
+                candidate_.capture(candidateState_);
+                field = compare(referenceState_, candidateState_, &detail);
+                if (!field.empty())
+                {
+                    fail(divergence, field, detail);
+                    return divergence;
+                }
+            }
+        }
+    }
+    return divergence;
+}
+
+void Chip8Lockstep::fail(Chip8Divergence& divergence, const std::string& field,
+                         const std::string& detail)
+{
+    reference_.capture(referenceState_);
+    candidate_.capture(candidateState_);
+
+    divergence.found = true;
+    divergence.field = field;
+
+    std::string report = fmt::format(
+        "{} diverged from {} after {} instructions (frame {}) at {}: {}", candidate_.getName(),
+        reference_.getName(), divergence.instructions, divergence.frame, field, detail);
+    if (field != "fault")
+    {
+        report += fmt::format(" ({} vs {})", reference_.getName(), candidate_.getName());
+    }
+    report += "\n";
+
+    report += fmt::format("Last instructions on {}:\n", reference_.getName());
+    size_t count = std::min(historyCount_, HISTORY_LENGTH);
+    for (size_t i = historyCount_ - count; i < historyCount_; ++i)
+    {
+        report += "    " + Chip8Disassembler::disassembleAt(referenceState_.memory,
+                                                            history_[i % HISTORY_LENGTH]) +
+                  "\n";
+    }
+    report += fmt::format("Next on {}:\n", reference_.getName());
+    for (int i = 0; i < CONTEXT_AFTER; ++i)
+    {
+        report += "    " + Chip8Disassembler::disassembleAt(referenceState_.memory,
+                                                            referenceState_.PC + 2 * i) +
+                  "\n";
+    }
+    report += formatRegisters(reference_.getName(), referenceState_);
+    report += formatRegisters(candidate_.getName(), candidateState_);
+
+    divergence.report = report;
+    spdlog::debug("Chip8 Lockstep: {}", report);
+}
+} // namespace chip8core
@@ -0,0 +1,212 @@
+#include "Chip8Core/Chip8Movie.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <fstream>
+
+namespace chip8core
+{
+namespace
+{
+constexpr char MAGIC[4] = {'C', '8', 'M', 'V'};
+
+void writeVarint(std::ostream& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.put(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.put(static_cast<char>(value));
+}
+
+uint8_t readByte(std::istream& in)
+{
+    char byte;
+    if (!in.get(byte))
+    {
+        throw Chip8MovieError("Truncated movie");
+    }
+    return static_cast<uint8_t>(byte);
+}
+
+uint64_t readVarint(std::istream& in)
+{
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        uint8_t byte = readByte(in);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+    throw Chip8MovieError("Malformed varint in movie");
+}
+} // namespace
+
+void Chip8Movie::write(std::ostream& out) const
+{
+    out.write(MAGIC, sizeof(MAGIC));
+    out.put(static_cast<char>(VERSION));
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        out.put(static_cast<char>(seed >> shift));
+    }
+    writeVarint(out, cpuHz);
+    writeVarint(out, length);
+    writeVarint(out, events.size());
+
+    uint64_t previous = 0;
+    for (const Chip8MovieEvent& event : events)
+    {
+        writeVarint(out, event.cycle - previous);
+        out.put(static_cast<char>(event.keyMask));
+        out.put(static_cast<char>(event.keyMask >> 8));
+        previous = event.cycle;
+    }
+}
+
+Chip8Movie Chip8Movie::read(std::istream& in)
+{
+    for (char expected : MAGIC)
+    {
+        if (static_cast<char>(readByte(in)) != expected)
+        {
+            throw Chip8MovieError("Not a Chip8 movie");
+        }
+    }
+    uint8_t version = readByte(in);
+    if (version < 1 || version > VERSION)
+    {
+        throw Chip8MovieError("Unsupported movie version " + std::to_string(version));
+    }
+
+    Chip8Movie movie;
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        movie.seed |= static_cast<uint32_t>(readByte(in)) << shift;
+    }
+    if (version >= 2)
+    {
+        uint64_t cpuHz = readVarint(in);
+        if (cpuHz < Chip8::TIMER_HZ || cpuHz > UINT32_MAX)
+        {
+            throw Chip8MovieError("Invalid CPU rate in movie: " + std::to_string(cpuHz));
+        }
+        movie.cpuHz = static_cast<uint32_t>(cpuHz);
+    }
+    movie.length = readVarint(in);
+
+    uint64_t count = readVarint(in);
+    uint64_t cycle = 0;
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        cycle += readVarint(in);
+        uint16_t keyMask = readByte(in);
+        keyMask |= static_cast<uint16_t>(readByte(in) << 8);
+        movie.events.push_back({cycle, keyMask});
+    }
+    return movie;
+}
+
+bool Chip8Movie::save(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary);
+    write(file);
+    if (!file)
+    {
+        spdlog::error("Failed to write movie file: {}", path);
+        return false;
+    }
+    return true;
+}
+
+bool Chip8Movie::load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        spdlog::error("Failed to open movie file: {}", path);
+        return false;
+    }
+    try
+    {
+        *this = read(file);
+    }
+    catch (const Chip8MovieError& e)
+    {
+        spdlog::error("Failed to read movie file {}: {}", path, e.what());
+        return false;
+    }
+    spdlog::info("Loaded movie: {} ({} key changes over {} cycles)", path, events.size(),
+                 length);
+    return true;
+}
+
+Chip8MovieRecorder::Chip8MovieRecorder(const Chip8& machine)
+{
+    movie_.seed  = machine.getCPU().getSeed();
+    movie_.cpuHz = static_cast<uint32_t>(machine.getCpuHz());
+    onKeysChanged(machine.getCycleCount(), machine.getInput().getKeyMask());
+    if (machine.getCycleCount() != 0)
+    {
+        spdlog::warn("Movie recording started {} cycles after reset; playback will differ",
+                     machine.getCycleCount());
+    }
+}
+
+void Chip8MovieRecorder::poll(Chip8& machine)
+{
+    onKeysChanged(machine.getCycleCount(), machine.getInput().getKeyMask());
+}
+
+void Chip8MovieRecorder::onKeysChanged(uint64_t cycle, uint16_t keyMask)
+{
+    if (keyMask != keyMask_)
+    {
+        movie_.events.push_back({cycle, keyMask});
+        keyMask_ = keyMask;
+    }
+}
+
+const Chip8Movie& Chip8MovieRecorder::finish(const Chip8& machine)
+{
+    movie_.length = machine.getCycleCount();
+    return movie_;
+}
+
+void Chip8MoviePlayer::start(Chip8& machine, const uint8_t* romData, size_t romSize)
+{
+    machine.setSeed(movie_.seed);
+    machine.setCpuHz(static_cast<int>(movie_.cpuHz));
+    machine.reset();
+    machine.loadROM(romData, romSize);
+    machine.getInput().setKeyMask(0);
+    nextEvent_ = 0;
+}
+
+uint64_t Chip8MoviePlayer::advance(Chip8& machine, uint64_t cycles)
+{
+    uint64_t start = machine.getCycleCount();
+    uint64_t end   = std::min(movie_.length, start + cycles);
+    while (machine.getCycleCount() < end)
+    {
+        // Apply every change due now, then run up to the next one
+        while (nextEvent_ < movie_.events.size() &&
+               movie_.events[nextEvent_].cycle <= machine.getCycleCount())
+        {
+            machine.getInput().setKeyMask(movie_.events[nextEvent_++].keyMask);
+        }
+        uint64_t until = end;
+        if (nextEvent_ < movie_.events.size())
+        {
+            until = std::min(until, movie_.events[nextEvent_].cycle);
+        }
+        machine.runCycles(until - machine.getCycleCount());
+    }
+    return machine.getCycleCount() - start;
+}
+} // namespace chip8core
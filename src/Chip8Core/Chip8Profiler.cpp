@@ -0,0 +1,192 @@
+#include "Chip8Core/Chip8Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <numeric>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#define CHIP8_PROFILER_TSC 1
+#endif
+
+namespace chip8core
+{
+namespace
+{
+const char* const CLASS_NAMES[Chip8Profiler::CLASS_COUNT] = {
+    "00E0", "00EE", "1NNN", "2NNN", "3XKK", "4XKK", "5XY0", "6XKK", "7XKK",
+    "8XY0", "8XY1", "8XY2", "8XY3", "8XY4", "8XY5", "8XY6", "8XY7", "8XYE",
+    "9XY0", "ANNN", "BNNN", "CXKK", "DXYN", "EX9E", "EXA1", "F002", "FX07",
+    "FX0A", "FX15", "FX18", "FX1E", "FX29", "FX33", "FX3A", "FX55", "FX65",
+    "invalid"};
+
+constexpr size_t INVALID_CLASS = Chip8Profiler::CLASS_COUNT - 1;
+} // namespace
+
+Chip8Profiler::Chip8Profiler(uint32_t sampleInterval)
+    : classCounts_(CLASS_COUNT), sampleCounts_(CLASS_COUNT), sampledTime_(CLASS_COUNT),
+      pcCounts_(PC_COUNT)
+{
+    setSampleInterval(sampleInterval);
+}
+
+void Chip8Profiler::reset()
+{
+    sinceSample_  = 0;
+    instructions_ = 0;
+    std::fill(classCounts_.begin(), classCounts_.end(), 0);
+    std::fill(sampleCounts_.begin(), sampleCounts_.end(), 0);
+    std::fill(sampledTime_.begin(), sampledTime_.end(), 0);
+    std::fill(pcCounts_.begin(), pcCounts_.end(), 0);
+}
+
+uint64_t Chip8Profiler::timestamp()
+{
+#ifdef CHIP8_PROFILER_TSC
+    return __rdtsc();
+#else
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+const char* Chip8Profiler::getTimeUnit()
+{
+#ifdef CHIP8_PROFILER_TSC
+    return "tsc";
+#else
+    return "ns";
+#endif
+}
+
+size_t Chip8Profiler::classify(uint16_t opcode)
+{
+    uint8_t low = opcode & 0xF;
+    switch (opcode >> 12)
+    {
+    case 0x0:
+        return low == 0x0 ? 0 : low == 0xE ? 1 : INVALID_CLASS;
+    case 0x8:
+        if (low <= 0x7)
+            return 9 + low;
+        return low == 0xE ? 17 : INVALID_CLASS;
+    case 0x9:
+        return 18;
+    case 0xA:
+        return 19;
+    case 0xB:
+        return 20;
+    case 0xC:
+        return 21;
+    case 0xD:
+        return 22;
+    case 0xE:
+        return low == 0xE ? 23 : low == 0x1 ? 24 : INVALID_CLASS;
+    case 0xF:
+        switch (opcode & 0xFF)
+        {
+        case 0x02:
+            return 25;
+        case 0x07:
+            return 26;
+        case 0x0A:
+            return 27;
+        case 0x15:
+            return 28;
+        case 0x18:
+            return 29;
+        case 0x1E:
+            return 30;
+        case 0x29:
+            return 31;
+        case 0x33:
+            return 32;
+        case 0x3A:
+            return 33;
+        case 0x55:
+            return 34;
+        case 0x65:
+            return 35;
+        default:
+            return INVALID_CLASS;
+        }
+    default:
+        // 1NNN through 7XKK map directly onto classes 2 to 8
+        return (opcode >> 12) + 1;
+    }
+}
+
+const char* Chip8Profiler::className(size_t opcodeClass)
+{
+    return opcodeClass < CLASS_COUNT ? CLASS_NAMES[opcodeClass] : CLASS_NAMES[INVALID_CLASS];
+}
+
+std::vector<uint16_t> Chip8Profiler::getHotPCs(size_t count) const
+{
+    std::vector<uint16_t> pcs(PC_COUNT);
+    std::iota(pcs.begin(), pcs.end(), 0);
+    pcs.erase(std::remove_if(pcs.begin(), pcs.end(), [this](uint16_t pc)
+                             { return pcCounts_[pc] == 0; }),
+              pcs.end());
+    count = std::min(count, pcs.size());
+    std::partial_sort(pcs.begin(), pcs.begin() + count, pcs.end(),
+                      [this](uint16_t a, uint16_t b) { return pcCounts_[a] > pcCounts_[b]; });
+    pcs.resize(count);
+    return pcs;
+}
+
+void Chip8Profiler::dumpText(std::ostream& out, size_t hotPCs) const
+{
+    out << "Instructions: " << instructions_ << "\n";
+    out << std::left << std::setw(8) << "Class" << std::right << std::setw(14) << "Count"
+        << std::setw(9) << "Share" << std::setw(12) << "Samples" << std::setw(14)
+        << "Avg " << getTimeUnit() << "\n";
+    for (size_t i = 0; i < CLASS_COUNT; ++i)
+    {
+        if (classCounts_[i] == 0)
+        {
+            continue;
+        }
+        double share = 100.0 * classCounts_[i] / instructions_;
+        double avg   = sampleCounts_[i] ? double(sampledTime_[i]) / sampleCounts_[i] : 0.0;
+        out << std::left << std::setw(8) << CLASS_NAMES[i] << std::right << std::setw(14)
+            << classCounts_[i] << std::setw(8) << std::fixed << std::setprecision(2) << share
+            << "%" << std::setw(12) << sampleCounts_[i] << std::setw(18) << std::setprecision(1)
+            << avg << "\n";
+    }
+
+    out << "Hot addresses:\n";
+    for (uint16_t pc : getHotPCs(hotPCs))
+    {
+        out << "  0x" << std::hex << std::setw(3) << std::setfill('0') << pc << std::dec
+            << std::setfill(' ') << std::setw(14) << pcCounts_[pc] << "\n";
+    }
+}
+
+void Chip8Profiler::dumpJSON(std::ostream& out, size_t hotPCs) const
+{
+    out << "{\"instructions\":" << instructions_ << ",\"timeUnit\":\"" << getTimeUnit()
+        << "\",\"sampleInterval\":" << sampleInterval_ << ",\"classes\":[";
+    bool first = true;
+    for (size_t i = 0; i < CLASS_COUNT; ++i)
+    {
+        if (classCounts_[i] == 0)
+        {
+            continue;
+        }
+        out << (first ? "" : ",") << "{\"name\":\"" << CLASS_NAMES[i]
+            << "\",\"count\":" << classCounts_[i] << ",\"samples\":" << sampleCounts_[i]
+            << ",\"time\":" << sampledTime_[i] << "}";
+        first = false;
+    }
+    out << "],\"hotPCs\":[";
+    first = true;
+    for (uint16_t pc : getHotPCs(hotPCs))
+    {
+        out << (first ? "" : ",") << "{\"pc\":" << pc << ",\"count\":" << pcCounts_[pc] << "}";
+        first = false;
+    }
+    out << "]}";
+}
+} // namespace chip8core
@@ -0,0 +1,222 @@
+#include "Chip8Core/Chip8Runner.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace chip8core
+{
+Chip8Runner::Chip8Runner(size_t machines, size_t threads, bool pinThreads)
+    : results_(machines)
+{
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    machines_.reserve(machines);
+    for (size_t i = 0; i < machines; ++i)
+    {
+        machines_.push_back(std::make_unique<Chip8>());
+    }
+    reset();
+
+    queues_ = std::make_unique<WorkQueue[]>(threads);
+    workers_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i)
+    {
+        workers_.emplace_back(&Chip8Runner::workerLoop, this, i);
+        if (pinThreads)
+        {
+            pinToCore(workers_.back(), i);
+        }
+    }
+    spdlog::debug("Chip8 Runner created with {} machines on {} threads", machines, threads);
+}
+
+Chip8Runner::~Chip8Runner()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    startFrame_.notify_all();
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+    spdlog::debug("Chip8 Runner destroyed");
+}
+
+void Chip8Runner::reset(uint32_t seed)
+{
+    for (size_t i = 0; i < machines_.size(); ++i)
+    {
+        machines_[i]->setSeed(seed + static_cast<uint32_t>(i));
+        machines_[i]->reset();
+        results_[i] = Chip8RunnerResult{};
+    }
+}
+
+void Chip8Runner::loadROM(const uint8_t* romData, size_t romSize)
+{
+    for (auto& machine : machines_)
+    {
+        machine->loadROM(romData, romSize);
+    }
+}
+
+void Chip8Runner::runFrames(int frames, int cyclesPerFrame)
+{
+    size_t batches = (machines_.size() + MACHINES_PER_BATCH - 1) / MACHINES_PER_BATCH;
+    size_t threads = workers_.size();
+
+    for (int frame = 0; frame < frames; ++frame)
+    {
+        // Deal batches out to workers in contiguous ranges
+        for (size_t w = 0; w < threads; ++w)
+        {
+            queues_[w].next.store(batches * w / threads, std::memory_order_relaxed);
+            queues_[w].end = batches * (w + 1) / threads;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        cyclesPerFrame_ = cyclesPerFrame;
+        lastFrame_      = frame == frames - 1;
+        pendingWorkers_ = threads;
+        ++generation_;
+        startFrame_.notify_all();
+
+        // Barrier: the next frame starts only when every worker has drained
+        frameDone_.wait(lock, [this] { return pendingWorkers_ == 0; });
+    }
+}
+
+void Chip8Runner::workerLoop(size_t index)
+{
+    uint64_t seenGeneration = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            startFrame_.wait(lock,
+                             [&] { return stopping_ || generation_ != seenGeneration; });
+            if (stopping_)
+            {
+                return;
+            }
+            seenGeneration = generation_;
+        }
+
+        size_t batch;
+        while (nextBatch(index, batch))
+        {
+            runBatch(batch);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--pendingWorkers_ == 0)
+        {
+            frameDone_.notify_one();
+        }
+    }
+}
+
+bool Chip8Runner::nextBatch(size_t worker, size_t& batch)
+{
+    size_t threads = workers_.size();
+
+    // Own queue first, then steal from the others starting at the next worker
+    for (size_t i = 0; i < threads; ++i)
+    {
+        WorkQueue& queue = queues_[(worker + i) % threads];
+        if (queue.next.load(std::memory_order_relaxed) >= queue.end)
+        {
+            continue;
+        }
+        size_t candidate = queue.next.fetch_add(1, std::memory_order_relaxed);
+        if (candidate < queue.end)
+        {
+            batch = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+void Chip8Runner::runBatch(size_t batch)
+{
+    size_t first = batch * MACHINES_PER_BATCH;
+    size_t last  = std::min(first + MACHINES_PER_BATCH, machines_.size());
+    for (size_t i = first; i < last; ++i)
+    {
+        runMachine(i);
+    }
+}
+
+void Chip8Runner::runMachine(size_t index)
+{
+    Chip8&             machine = *machines_[index];
+    Chip8RunnerResult& result  = results_[index];
+    if (result.exitReason == Chip8ExitReason::Fault)
+    {
+        return;
+    }
+
+    try
+    {
+        machine.runFrame(cyclesPerFrame_);
+    }
+    catch (const std::exception& e)
+    {
+        spdlog::error("Machine {} faulted: {}", index, e.what());
+        result.exitReason = Chip8ExitReason::Fault;
+    }
+
+    if (!lastFrame_)
+    {
+        return;
+    }
+
+    const Chip8GraphicsBuffer& graphics = machine.getGraphics();
+    std::memcpy(result.framebuffer, graphics.data(), sizeof(result.framebuffer));
+    result.soundOn = machine.getSoundTimer().getValue() > 0;
+
+    if (result.exitReason != Chip8ExitReason::Fault)
+    {
+        // A jump to its own address is the conventional way for a ROM to stop
+        uint16_t pc     = machine.getCPU().getPC();
+        uint16_t opcode = 0;
+        if (pc + 1 < Chip8Memory::MEMORY_SIZE)
+        {
+            opcode = machine.getMemory().read(pc) << 8 | machine.getMemory().read(pc + 1);
+        }
+        result.exitReason = (opcode == (0x1000 | pc)) ? Chip8ExitReason::Halted
+                                                      : Chip8ExitReason::Running;
+    }
+}
+
+void Chip8Runner::pinToCore(std::thread& thread, size_t core)
+{
+#if defined(__linux__)
+    unsigned  cores = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % cores, &set);
+    if (pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) != 0)
+    {
+        spdlog::warn("Failed to pin worker thread to core {}", core % cores);
+    }
+#else
+    (void)thread;
+    spdlog::warn("Pinning worker threads is not supported on this platform (core {})", core);
+#endif
+}
+} // namespace chip8core
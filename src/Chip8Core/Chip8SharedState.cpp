@@ -0,0 +1,107 @@
+#include "Chip8Core/Chip8SharedState.h"
+
+namespace chip8core
+{
+Chip8SharedState::Chip8SharedState()
+{
+    for (std::atomic<uint32_t>& word : words_)
+    {
+        word.store(0, std::memory_order_relaxed);
+    }
+}
+
+void Chip8SharedState::publishFrame(const Chip8GraphicsBuffer& graphics)
+{
+    uint32_t sequence = words_[FRAME_SEQUENCE].load(std::memory_order_relaxed);
+    words_[FRAME_SEQUENCE].store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const uint64_t* rows = graphics.data();
+    for (uint32_t i = 0; i < Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT; ++i)
+    {
+        // Low word first, as a little-endian uint64 reads in WASM memory
+        words_[FRAME + 2 * i].store(static_cast<uint32_t>(rows[i]), std::memory_order_relaxed);
+        words_[FRAME + 2 * i + 1].store(static_cast<uint32_t>(rows[i] >> 32),
+                                        std::memory_order_relaxed);
+    }
+    store(FRAME_SEQUENCE, sequence + 2);
+}
+
+bool Chip8SharedState::readFrame(uint64_t* rows) const
+{
+    uint32_t before = load(FRAME_SEQUENCE);
+    if (before & 1)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT; ++i)
+    {
+        uint64_t low  = words_[FRAME + 2 * i].load(std::memory_order_relaxed);
+        uint64_t high = words_[FRAME + 2 * i + 1].load(std::memory_order_relaxed);
+        rows[i]       = high << 32 | low;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return words_[FRAME_SEQUENCE].load(std::memory_order_relaxed) == before;
+}
+
+void Chip8SharedState::publishEdge(const Chip8SoundEdge& edge)
+{
+    uint32_t count = words_[EDGE_COUNT].load(std::memory_order_relaxed);
+    uint32_t slot  = EDGES + (count % EDGE_CAPACITY) * EDGE_WORDS;
+
+    uint32_t values[EDGE_WORDS] = {static_cast<uint32_t>(edge.cycle),
+                                   static_cast<uint32_t>(edge.cycle >> 32), edge.on, edge.pitch,
+                                   edge.hasPattern};
+    for (uint32_t i = 0; i < sizeof(edge.pattern); ++i)
+    {
+        values[5 + i / 4] |= static_cast<uint32_t>(edge.pattern[i]) << (8 * (i % 4));
+    }
+    for (uint32_t i = 0; i < EDGE_WORDS; ++i)
+    {
+        words_[slot + i].store(values[i], std::memory_order_relaxed);
+    }
+    store(EDGE_COUNT, count + 1);
+}
+
+bool Chip8SharedState::readEdge(uint32_t& next, Chip8SoundEdge& edge) const
+{
+    uint32_t values[EDGE_WORDS];
+    for (;;)
+    {
+        uint32_t count = load(EDGE_COUNT);
+        if (count - next >= EDGE_CAPACITY)
+        {
+            // Fell behind; older edges are overwritten and the oldest slot may be being written
+            next = count - EDGE_CAPACITY + 1;
+        }
+        if (next == count)
+        {
+            return false;
+        }
+
+        uint32_t slot = EDGES + (next % EDGE_CAPACITY) * EDGE_WORDS;
+        for (uint32_t i = 0; i < EDGE_WORDS; ++i)
+        {
+            values[i] = words_[slot + i].load(std::memory_order_relaxed);
+        }
+
+        // Keep the copy unless the writer came round to the slot while it was read
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (words_[EDGE_COUNT].load(std::memory_order_relaxed) - next < EDGE_CAPACITY)
+        {
+            break;
+        }
+    }
+    edge.cycle      = static_cast<uint64_t>(values[1]) << 32 | values[0];
+    edge.on         = values[2] != 0;
+    edge.pitch      = static_cast<uint8_t>(values[3]);
+    edge.hasPattern = values[4] != 0;
+    for (uint32_t i = 0; i < sizeof(edge.pattern); ++i)
+    {
+        edge.pattern[i] = static_cast<uint8_t>(values[5 + i / 4] >> (8 * (i % 4)));
+    }
+    ++next;
+    return true;
+}
+} // namespace chip8core
@@ -0,0 +1,138 @@
+#include "Chip8Core/Chip8SoundRenderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <cstring>
+
+#include "Chip8Core/Chip8.h"
+
+namespace chip8core
+{
+Chip8SoundRenderer::Chip8SoundRenderer(int sampleRate, uint64_t latencyCycles)
+    : sampleRate_(static_cast<uint64_t>(std::max(sampleRate, 1))), latencyCycles_(latencyCycles)
+{
+    static_assert(CPU_HZ_STEP == Chip8::CPU_HZ, "Nominal speed is CPU_HZ cursor units per sample");
+
+    loadSquareWave();
+    squareStep_ = static_cast<uint32_t>((static_cast<uint64_t>(TONE_HZ) << 32) / sampleRate_);
+    phaseStep_  = squareStep_;
+
+    // A pattern loops every 128 bits, so its frequency is the bit rate / 128
+    for (int pitch = 0; pitch < 256; ++pitch)
+    {
+        double loopHz      = 4000.0 * std::pow(2.0, (pitch - 64) / 48.0) / 128.0;
+        pitchSteps_[pitch] = static_cast<uint32_t>(loopHz * 4294967296.0 / sampleRate_);
+    }
+    std::fill(std::begin(pattern_), std::end(pattern_), 0);
+}
+
+void Chip8SoundRenderer::render(uint8_t* out, size_t samples)
+{
+    // Keep playback latencyCycles_ behind the emulation, jumping if it drifts further
+    uint64_t emulated = emulatedCycle_.load(std::memory_order_acquire);
+    updateRate((emulated - std::min(emulated, latencyCycles_)) * sampleRate_);
+
+    size_t         done = 0;
+    Chip8SoundEdge edge;
+    while (done < samples)
+    {
+        size_t run = samples - done;
+        if (queue_.peek(edge))
+        {
+            uint64_t edgeAt = edge.cycle * sampleRate_;
+            if (edgeAt <= cursor_)
+            {
+                if (edge.on && !on_)
+                {
+                    phase_ = 0; // Every beep starts at the same point of the wave
+                }
+                on_ = edge.on;
+                setVoice(edge);
+                queue_.pop();
+                continue;
+            }
+            uint64_t untilEdge = (edgeAt - cursor_ + step_ - 1) / step_;
+            run                = static_cast<size_t>(std::min<uint64_t>(run, untilEdge));
+        }
+
+        if (on_)
+        {
+            fillTone(out + done, run);
+        }
+        else
+        {
+            std::memset(out + done, SILENCE, run);
+        }
+        done += run;
+        cursor_ += run * step_;
+    }
+    playedCycle_.store(cursor_ / sampleRate_, std::memory_order_release);
+}
+
+void Chip8SoundRenderer::updateRate(uint64_t target)
+{
+    int64_t error    = static_cast<int64_t>(cursor_ - target); // Positive when playing ahead
+    int64_t deadband = static_cast<int64_t>(latencyCycles_ * sampleRate_ / 3);
+    if (std::abs(error) > static_cast<int64_t>(latencyCycles_ * sampleRate_))
+    {
+        cursor_ = target;
+        step_   = CPU_HZ_STEP;
+        ++resyncs_;
+        return;
+    }
+
+    // Proportional beyond the deadband, full correction at the resync threshold
+    int64_t excess = std::max<int64_t>(std::abs(error) - deadband, 0);
+    int64_t adjust = excess == 0 ? 0 : 1 + excess * (MAX_RATE_ADJUST - 1) / (2 * deadband);
+    step_          = CPU_HZ_STEP - static_cast<int>(error > 0 ? adjust : -adjust);
+}
+
+void Chip8SoundRenderer::setVoice(const Chip8SoundEdge& edge)
+{
+    if (!edge.hasPattern)
+    {
+        if (hasPattern_)
+        {
+            loadSquareWave();
+            hasPattern_ = false;
+        }
+        phaseStep_ = squareStep_;
+        return;
+    }
+
+    if (!hasPattern_ || std::memcmp(pattern_, edge.pattern, sizeof(pattern_)) != 0)
+    {
+        // Two table entries per bit, most significant bit of each byte first
+        for (size_t i = 0; i < WAVETABLE_SIZE; ++i)
+        {
+            size_t bit    = i / 2;
+            wavetable_[i] = (edge.pattern[bit / 8] >> (7 - bit % 8)) & 1 ? 0xFF : 0x00;
+        }
+        std::memcpy(pattern_, edge.pattern, sizeof(pattern_));
+        hasPattern_ = true;
+    }
+    phaseStep_ = pitchSteps_[edge.pitch];
+}
+
+void Chip8SoundRenderer::loadSquareWave()
+{
+    // High for the first half of the period
+    for (size_t i = 0; i < WAVETABLE_SIZE; ++i)
+    {
+        wavetable_[i] = i < WAVETABLE_SIZE / 2 ? 0xFF : 0x00;
+    }
+}
+
+void Chip8SoundRenderer::fillTone(uint8_t* out, size_t samples)
+{
+    uint32_t phase = phase_;
+    for (size_t i = 0; i < samples; ++i)
+    {
+        out[i] = wavetable_[phase >> 24];
+        phase += phaseStep_;
+    }
+    phase_ = phase;
+}
+} // namespace chip8core
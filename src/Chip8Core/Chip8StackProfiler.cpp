@@ -0,0 +1,94 @@
+#include "Chip8Core/Chip8StackProfiler.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace chip8core
+{
+namespace
+{
+constexpr size_t STACK_DEPTH = 16;
+
+std::string frameName(uint16_t address, const Chip8Symbols* symbols)
+{
+    if (symbols)
+    {
+        return symbols->symbolize(address);
+    }
+    std::ostringstream hex;
+    hex << "0x" << std::uppercase << std::hex << std::setw(3) << std::setfill('0') << address;
+    return hex.str();
+}
+} // namespace
+
+Chip8StackProfiler::Chip8StackProfiler(uint32_t sampleInterval)
+{
+    setSampleInterval(sampleInterval);
+    frames_.reserve(STACK_DEPTH + 1);
+    spdlog::debug("Chip8 Stack Profiler created, sampling every {} instructions",
+                  sampleInterval_);
+}
+
+void Chip8StackProfiler::reset()
+{
+    sinceSample_ = 0;
+    samples_     = 0;
+    stacks_.clear();
+}
+
+void Chip8StackProfiler::sample(const Chip8CPU& cpu, const Chip8Memory& memory)
+{
+    frames_.clear();
+    size_t depth = std::min<size_t>(cpu.getSP(), STACK_DEPTH - 1);
+    for (size_t level = 1; level <= depth; ++level)
+    {
+        // The return address follows the 2NNN that pushed it; its target is the callee
+        uint16_t returnAddress = cpu.getStack(level);
+        uint16_t callSite      = returnAddress - 2;
+        uint16_t entry         = returnAddress;
+        if (returnAddress >= 2 && callSite + 1 < Chip8Memory::MEMORY_SIZE)
+        {
+            uint16_t opcode = memory.read(callSite) << 8 | memory.read(callSite + 1);
+            if ((opcode & 0xF000) == 0x2000)
+            {
+                entry = opcode & 0x0FFF;
+            }
+        }
+        frames_.push_back(entry);
+    }
+    frames_.push_back(cpu.getPC());
+
+    ++stacks_[frames_];
+    ++samples_;
+}
+
+void Chip8StackProfiler::writeFolded(std::ostream& out, const Chip8Symbols* symbols) const
+{
+    // Symbolized stacks can fold together, so merge them before writing
+    std::map<std::string, uint64_t> folded;
+    for (const auto& stack : stacks_)
+    {
+        std::string line;
+        std::string previous;
+        for (uint16_t address : stack.first)
+        {
+            std::string name = frameName(address, symbols);
+            if (symbols && name == previous)
+            {
+                continue;
+            }
+            line += (line.empty() ? "" : ";") + name;
+            previous = name;
+        }
+        folded[line] += stack.second;
+    }
+
+    for (const auto& line : folded)
+    {
+        out << line.first << " " << line.second << "\n";
+    }
+}
+} // namespace chip8core
@@ -0,0 +1,33 @@
+#include "Chip8Core/Chip8Stats.h"
+
+#include <iomanip>
+
+#include "Chip8Core/Chip8.h"
+
+namespace chip8core
+{
+namespace
+{
+void dumpHistogram(std::ostream& out, const char* name, const Chip8Histogram& histogram)
+{
+    out << "  " << std::left << std::setw(12) << name << std::right << std::fixed
+        << std::setprecision(2) << "p50 " << std::setw(8) << histogram.percentile(0.5) / 1e6
+        << " ms  p99 " << std::setw(8) << histogram.percentile(0.99) / 1e6 << " ms  max "
+        << std::setw(8) << histogram.getMax() / 1e6 << " ms  (" << histogram.getCount()
+        << " samples)\n";
+}
+} // namespace
+
+void Chip8Stats::dumpText(std::ostream& out, const std::string& label) const
+{
+    out << "Performance of " << label << "\n";
+    out << "  Instructions " << instructions << ", caught up " << cyclesCaughtUp << ", dropped "
+        << cyclesDropped << " (" << std::fixed << std::setprecision(2)
+        << cyclesDropped * 1000.0 / Chip8::CPU_HZ << " ms)\n";
+    out << "  Frames rendered " << framesRendered << ", skipped " << framesSkipped << "\n";
+    dumpHistogram(out, "Frame time", frameTime);
+    dumpHistogram(out, "Emulate", emulateTime);
+    dumpHistogram(out, "Render", renderTime);
+    dumpHistogram(out, "Present", presentTime);
+}
+} // namespace chip8core
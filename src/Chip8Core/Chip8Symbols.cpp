@@ -0,0 +1,540 @@
+#include "Chip8Core/Chip8Symbols.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <vector>
+
+namespace chip8core
+{
+namespace
+{
+using Tokens = std::vector<std::string>;
+
+constexpr uint32_t PROGRAM_START  = 0x200;
+constexpr uint32_t ADDRESS_LIMIT  = 0x10000;
+constexpr int      MAX_EXPANSION  = 32;
+const char* const  ASSIGNMENTS[]  = {":=", "+=", "-=", "=-", "|=", "&=", "^=", "<<=", ">>="};
+const char* const  COMPARISONS[]  = {"<", ">", "<=", ">="};
+const char* const  NO_OPERAND[]   = {"clear", "return", ";", "hires", "lores", "exit",
+                                     "scroll-left", "scroll-right", "audio"};
+const char* const  ONE_OPERAND[]  = {"jump", "jump0", "bcd", "save", "load", "saveflags",
+                                     "loadflags", "scroll-down", "scroll-up", "plane", "native"};
+
+template <size_t N> bool isOneOf(const std::string& token, const char* const (&list)[N])
+{
+    for (const char* entry : list)
+    {
+        if (token == entry)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parseNumber(const std::string& token, uint32_t& value)
+{
+    if (token.empty() || !(std::isdigit(static_cast<unsigned char>(token[0])) || token[0] == '-'))
+    {
+        return false;
+    }
+    try
+    {
+        size_t used = 0;
+        int    base = 10;
+        size_t skip = token[0] == '-' ? 1 : 0;
+        if (token.compare(skip, 2, "0x") == 0)
+        {
+            base = 16;
+            skip += 2;
+        }
+        else if (token.compare(skip, 2, "0b") == 0)
+        {
+            base = 2;
+            skip += 2;
+        }
+        long parsed = std::stol(token.substr(skip), &used, base);
+        if (skip + used != token.size())
+        {
+            return false;
+        }
+        value = static_cast<uint32_t>(token[0] == '-' ? -parsed : parsed);
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+Tokens tokenize(std::istream& in)
+{
+    Tokens      tokens;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        size_t i = 0;
+        while (i < line.size())
+        {
+            if (std::isspace(static_cast<unsigned char>(line[i])))
+            {
+                ++i;
+                continue;
+            }
+            if (line[i] == '#')
+            {
+                break;
+            }
+            size_t end = i + 1;
+            if (line[i] == '"')
+            {
+                end = line.find('"', i + 1);
+                end = end == std::string::npos ? line.size() : end + 1;
+            }
+            else
+            {
+                while (end < line.size() && !std::isspace(static_cast<unsigned char>(line[end])))
+                {
+                    ++end;
+                }
+            }
+            tokens.push_back(line.substr(i, end - i));
+            i = end;
+        }
+    }
+    return tokens;
+}
+
+std::string unquote(const std::string& token)
+{
+    if (token.size() >= 2 && token.front() == '"' && token.back() == '"')
+    {
+        return token.substr(1, token.size() - 2);
+    }
+    return token;
+}
+
+/**
+ * Assigns addresses to Octo labels by sizing every statement, without
+ * evaluating expressions. Octo reserves 0x200 for a jump to main unless
+ * main is the first label of the program.
+ */
+class OctoSizer
+{
+  public:
+    explicit OctoSizer(std::map<uint16_t, std::string>& labels) : labels_(labels) {}
+
+    bool     run(const Tokens& tokens) { return process(tokens, 0); }
+    uint32_t getAddress() const { return address_; }
+
+  private:
+    struct Macro
+    {
+        Tokens params;
+        Tokens body;
+    };
+
+    struct StringMode
+    {
+        std::string alphabet;
+        Tokens      body;
+    };
+
+    std::map<uint16_t, std::string>&  labels_;
+    std::map<std::string, Macro>      macros_;
+    std::map<std::string, StringMode> stringModes_;
+    std::set<std::string>            constants_;
+    uint32_t                          address_ = PROGRAM_START + 2;
+    bool                              first_   = true;
+
+    // Index after one value: a single token or a balanced { expression }
+    static size_t skipValue(const Tokens& tokens, size_t i)
+    {
+        if (i >= tokens.size() || tokens[i] != "{")
+        {
+            return i + 1;
+        }
+        int depth = 0;
+        for (; i < tokens.size(); ++i)
+        {
+            depth += tokens[i] == "{" ? 1 : tokens[i] == "}" ? -1 : 0;
+            if (depth == 0)
+            {
+                return i + 1;
+            }
+        }
+        return i;
+    }
+
+    static bool readBlock(const Tokens& tokens, size_t& i, Tokens& body)
+    {
+        if (i >= tokens.size() || tokens[i] != "{")
+        {
+            return false;
+        }
+        size_t end = skipValue(tokens, i);
+        body.assign(tokens.begin() + i + 1, tokens.begin() + end - 1);
+        i = end;
+        return true;
+    }
+
+    void label(uint32_t address, const std::string& name)
+    {
+        if (first_ && name == "main" && address == PROGRAM_START + 2)
+        {
+            // main comes first, so no jump is needed
+            address  = PROGRAM_START;
+            address_ = PROGRAM_START;
+        }
+        first_ = false;
+        // Anonymous labels carry no information for a profile
+        if (name != "-" && name != "+" && address < ADDRESS_LIMIT)
+        {
+            labels_[static_cast<uint16_t>(address)] = name;
+        }
+    }
+
+    bool expandMacro(const Macro& macro, const Tokens& tokens, size_t& i, int depth)
+    {
+        std::map<std::string, Tokens> args;
+        for (const std::string& param : macro.params)
+        {
+            size_t end = skipValue(tokens, i);
+            if (end > tokens.size())
+            {
+                return false;
+            }
+            args[param].assign(tokens.begin() + i, tokens.begin() + end);
+            i = end;
+        }
+        Tokens expanded;
+        for (const std::string& token : macro.body)
+        {
+            auto arg = args.find(token);
+            if (arg == args.end())
+            {
+                expanded.push_back(token);
+            }
+            else
+            {
+                expanded.insert(expanded.end(), arg->second.begin(), arg->second.end());
+            }
+        }
+        return process(expanded, depth + 1);
+    }
+
+    bool expandString(const StringMode& mode, const std::string& text, int depth)
+    {
+        for (size_t index = 0; index < text.size(); ++index)
+        {
+            size_t value = mode.alphabet.find(text[index]);
+            if (value == std::string::npos)
+            {
+                return false;
+            }
+            Tokens expanded;
+            for (const std::string& token : mode.body)
+            {
+                if (token == "VALUE")
+                {
+                    expanded.push_back(std::to_string(value));
+                }
+                else if (token == "CHAR")
+                {
+                    expanded.push_back(std::to_string(static_cast<unsigned char>(text[index])));
+                }
+                else if (token == "INDEX")
+                {
+                    expanded.push_back(std::to_string(index));
+                }
+                else
+                {
+                    expanded.push_back(token);
+                }
+            }
+            if (!process(expanded, depth + 1))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool process(const Tokens& tokens, int depth)
+    {
+        if (depth > MAX_EXPANSION)
+        {
+            return false;
+        }
+
+        size_t i = 0;
+        while (i < tokens.size())
+        {
+            const std::string& token = tokens[i];
+            const std::string  next  = i + 1 < tokens.size() ? tokens[i + 1] : std::string();
+            uint32_t           number;
+
+            if (token == ":" || token == ":next")
+            {
+                label(address_ + (token == ":next" ? 1 : 0), next);
+                i += 2;
+            }
+            else if (token == ":alias" || token == ":const" || token == ":calc")
+            {
+                if (token != ":alias")
+                {
+                    constants_.insert(next);
+                }
+                i = skipValue(tokens, i + 2);
+            }
+            else if (token == ":macro")
+            {
+                Macro macro;
+                for (i += 2; i < tokens.size() && tokens[i] != "{"; ++i)
+                {
+                    macro.params.push_back(tokens[i]);
+                }
+                if (!readBlock(tokens, i, macro.body))
+                {
+                    return false;
+                }
+                macros_[next] = macro;
+            }
+            else if (token == ":stringmode")
+            {
+                StringMode mode;
+                mode.alphabet = unquote(i + 2 < tokens.size() ? tokens[i + 2] : std::string());
+                i += 3;
+                if (!readBlock(tokens, i, mode.body))
+                {
+                    return false;
+                }
+                stringModes_[next] = mode;
+            }
+            else if (token == ":org")
+            {
+                if (!parseNumber(next, number))
+                {
+                    return false;
+                }
+                address_ = number;
+                i += 2;
+            }
+            else if (token == ":byte" || token == ":pointer" || token == ":call")
+            {
+                address_ += token == ":byte" ? 1 : 2;
+                i = skipValue(tokens, i + 1);
+            }
+            else if (token == ":unpack")
+            {
+                address_ += 4;
+                i = next == "long" ? skipValue(tokens, i + 2)
+                                   : skipValue(tokens, skipValue(tokens, i + 1));
+            }
+            else if (token == ":breakpoint")
+            {
+                i += 2;
+            }
+            else if (token == ":monitor")
+            {
+                i = skipValue(tokens, skipValue(tokens, i + 1));
+            }
+            else if (token == ":assert")
+            {
+                i = next.size() && next[0] == '"' ? i + 2 : i + 1;
+                i = skipValue(tokens, i);
+            }
+            else if (token == "loop" || token == "end")
+            {
+                ++i;
+            }
+            else if (token == "again" || token == "else")
+            {
+                address_ += 2;
+                ++i;
+            }
+            else if (token == "if" || token == "while")
+            {
+                // Relational comparisons assemble into a subtraction through vF first
+                const std::string op = i + 2 < tokens.size() ? tokens[i + 2] : std::string();
+                if (isOneOf(op, COMPARISONS))
+                {
+                    address_ += 4;
+                }
+                if (token == "while")
+                {
+                    address_ += 4;
+                    i = op == "key" || op == "-key" ? i + 3 : skipValue(tokens, i + 3);
+                }
+                else
+                {
+                    size_t end = i + 1;
+                    while (end < tokens.size() && tokens[end] != "then" && tokens[end] != "begin")
+                    {
+                        ++end;
+                    }
+                    address_ += end < tokens.size() && tokens[end] == "begin" ? 4 : 2;
+                    i = end + 1;
+                }
+            }
+            else if (isOneOf(token, NO_OPERAND))
+            {
+                address_ += 2;
+                ++i;
+            }
+            else if (isOneOf(token, ONE_OPERAND))
+            {
+                address_ += 2;
+                i = skipValue(tokens, i + 1);
+                if (i < tokens.size() && tokens[i] == "-" && (token == "save" || token == "load"))
+                {
+                    i += 2;
+                }
+            }
+            else if (token == "sprite")
+            {
+                address_ += 2;
+                i = skipValue(tokens, skipValue(tokens, skipValue(tokens, i + 1)));
+            }
+            else if (isOneOf(next, ASSIGNMENTS))
+            {
+                const std::string rhs = i + 2 < tokens.size() ? tokens[i + 2] : std::string();
+                if (token == "i" && rhs == "long")
+                {
+                    address_ += 4;
+                    i = skipValue(tokens, i + 3);
+                }
+                else if (rhs == "random" || rhs == "hex" || rhs == "bighex")
+                {
+                    address_ += 2;
+                    i = skipValue(tokens, i + 3);
+                }
+                else
+                {
+                    address_ += 2;
+                    i = skipValue(tokens, i + 2);
+                }
+            }
+            else if (macros_.count(token))
+            {
+                ++i;
+                if (!expandMacro(macros_[token], tokens, i, depth))
+                {
+                    return false;
+                }
+            }
+            else if (stringModes_.count(token))
+            {
+                if (!expandString(stringModes_[token], unquote(next), depth))
+                {
+                    return false;
+                }
+                i += 2;
+            }
+            else if (token == "{" || constants_.count(token) || parseNumber(token, number))
+            {
+                address_ += 1;
+                i = skipValue(tokens, i);
+            }
+            else if (token[0] == ':' || token[0] == '"' || token == "}")
+            {
+                spdlog::debug("Chip8 Symbols: cannot size '{}' at 0x{:X}", token, address_);
+                return false;
+            }
+            else
+            {
+                // A bare label name is a subroutine call
+                address_ += 2;
+                ++i;
+            }
+        }
+        return true;
+    }
+};
+} // namespace
+
+bool Chip8Symbols::load(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        spdlog::error("Failed to open symbol file: {}", path);
+        return false;
+    }
+
+    if (path.size() >= 3 && path.compare(path.size() - 3, 3, ".8o") == 0)
+    {
+        loadOcto(file);
+    }
+    else
+    {
+        loadMap(file);
+    }
+    spdlog::info("Loaded {} symbols from {}", labels_.size(), path);
+    return true;
+}
+
+void Chip8Symbols::loadMap(std::istream& in)
+{
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::istringstream fields(line.substr(0, line.find('#')));
+        std::string        first, second;
+        if (!(fields >> first >> second))
+        {
+            continue;
+        }
+        uint32_t address;
+        if (parseNumber(first, address) && address < ADDRESS_LIMIT)
+        {
+            labels_[static_cast<uint16_t>(address)] = second;
+        }
+        else if (parseNumber(second, address) && address < ADDRESS_LIMIT)
+        {
+            labels_[static_cast<uint16_t>(address)] = first;
+        }
+    }
+}
+
+uint16_t Chip8Symbols::loadOcto(std::istream& in)
+{
+    OctoSizer sizer(labels_);
+    if (!sizer.run(tokenize(in)))
+    {
+        spdlog::warn("Chip8 Symbols: Octo source only partially sized, later labels are missing");
+        return 0;
+    }
+    return static_cast<uint16_t>(sizer.getAddress());
+}
+
+std::string Chip8Symbols::symbolize(uint16_t address) const
+{
+    auto label = labels_.upper_bound(address);
+    if (label != labels_.begin())
+    {
+        return std::prev(label)->second;
+    }
+    std::ostringstream hex;
+    hex << "0x" << std::uppercase << std::hex << std::setw(3) << std::setfill('0') << address;
+    return hex.str();
+}
+
+bool Chip8Symbols::find(const std::string& name, uint16_t& address) const
+{
+    for (const auto& label : labels_)
+    {
+        if (label.second == name)
+        {
+            address = label.first;
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace chip8core
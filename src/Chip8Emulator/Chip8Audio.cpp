@@ -2,13 +2,13 @@
 
 #include <spdlog/spdlog.h>
 
-Chip8Audio::Chip8Audio() : device_(0), playing_(false), phase_(0)
+Chip8Audio::Chip8Audio(int bufferSamples) : device_(0), renderer_(SAMPLE_RATE)
 {
     SDL_zero(spec_);
-    spec_.freq     = 44100;
+    spec_.freq     = SAMPLE_RATE;
     spec_.format   = AUDIO_U8;
     spec_.channels = 1;
-    spec_.samples  = 512;
+    spec_.samples  = static_cast<Uint16>(bufferSamples);
     spec_.callback = Chip8Audio::audioCallback;
     spec_.userdata = this;
 
@@ -18,6 +18,11 @@ Chip8Audio::Chip8Audio() : device_(0), playing_(false), phase_(0)
     {
         SDL_Log("Failed to open audio: %s", SDL_GetError());
     }
+    else
+    {
+        // Runs for good; the renderer outputs silence between beeps
+        SDL_PauseAudioDevice(device_, 0);
+    }
 }
 
 Chip8Audio::~Chip8Audio()
@@ -26,50 +31,19 @@ Chip8Audio::~Chip8Audio()
         SDL_CloseAudioDevice(device_);
 }
 
-void Chip8Audio::processAudio(const chip8core::Chip8Timer& soundTimer)
+void Chip8Audio::processAudio(const chip8core::Chip8& chip8)
 {
-    if (soundTimer.getValue() > 0)
-    {
-        play();
-    }
-    else
-    {
-        stop();
-    }
+    renderer_.setEmulatedCycle(chip8.getEmulatedClock());
 }
 
-void Chip8Audio::play()
+void Chip8Audio::setPaused(bool paused)
 {
-
-    playing_ = true;
     if (device_ != 0)
-        SDL_PauseAudioDevice(device_, 0);
-}
-
-void Chip8Audio::stop()
-{
-    playing_ = false;
-    if (device_ != 0)
-        SDL_PauseAudioDevice(device_, 1);
+        SDL_PauseAudioDevice(device_, paused ? 1 : 0);
 }
 
 void Chip8Audio::audioCallback(void* userdata, Uint8* stream, int len)
 {
-    auto*  self            = static_cast<Chip8Audio*>(userdata);
-    Uint8* buf             = stream;
-    int    freq            = 440; // Square wave frequency (Hz)
-    int    samplesPerCycle = self->spec_.freq / freq;
-
-    for (int i = 0; i < len; ++i)
-    {
-        if (self->playing_)
-        {
-            buf[i] = (self->phase_ < samplesPerCycle / 2) ? 0xFF : 0x00; // Square wave
-        }
-        else
-        {
-            buf[i] = 0x80; // Silence (center for AUDIO_U8)
-        }
-        self->phase_ = (self->phase_ + 1) % samplesPerCycle;
-    }
-}
\ No newline at end of file
+    auto* self = static_cast<Chip8Audio*>(userdata);
+    self->renderer_.render(stream, static_cast<size_t>(len));
+}
@@ -6,7 +6,8 @@ Chip8Display::Chip8Display(int width, int height, int scale)
     SDL_Init(SDL_INIT_VIDEO);
     window_   = SDL_CreateWindow("Chip8", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
                                  width_ * scale_, height_ * scale_, SDL_WINDOW_SHOWN);
-    renderer_ = SDL_CreateRenderer(window_, -1, SDL_RENDERER_ACCELERATED);
+    renderer_ = SDL_CreateRenderer(window_, -1,
+                                   SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
 }
 
 Chip8Display::~Chip8Display()
@@ -17,6 +18,12 @@ Chip8Display::~Chip8Display()
 }
 
 void Chip8Display::render(const chip8core::Chip8GraphicsBuffer& buffer)
+{
+    draw(buffer);
+    present();
+}
+
+void Chip8Display::draw(const chip8core::Chip8GraphicsBuffer& buffer)
 {
     SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 255);
     SDL_RenderClear(renderer_);
@@ -32,5 +39,19 @@ void Chip8Display::render(const chip8core::Chip8GraphicsBuffer& buffer)
             }
         }
     }
+}
+
+void Chip8Display::present()
+{
     SDL_RenderPresent(renderer_);
+}
+
+int Chip8Display::getRefreshRate() const
+{
+    SDL_DisplayMode mode;
+    if (SDL_GetWindowDisplayMode(window_, &mode) == 0 && mode.refresh_rate > 0)
+    {
+        return mode.refresh_rate;
+    }
+    return 60;
 }
\ No newline at end of file
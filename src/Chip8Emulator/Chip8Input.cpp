@@ -2,8 +2,48 @@
 
 #include <spdlog/spdlog.h>
 
-void Chip8Input::pollEvents(chip8core::Chip8InputBuffer& input, bool& running)
+#include "Chip8Core/Chip8Stats.h"
+
+namespace
+{
+struct KeyBinding
+{
+    SDL_Scancode scancode;
+    uint8_t      key;
+};
+
+// The usual 4x4 block on the left of the keyboard
+constexpr KeyBinding KEY_BINDINGS[] = {
+    {SDL_SCANCODE_1, 0x1}, {SDL_SCANCODE_2, 0x2}, {SDL_SCANCODE_3, 0x3}, {SDL_SCANCODE_4, 0xC},
+    {SDL_SCANCODE_Q, 0x4}, {SDL_SCANCODE_W, 0x5}, {SDL_SCANCODE_E, 0x6}, {SDL_SCANCODE_R, 0xD},
+    {SDL_SCANCODE_A, 0x7}, {SDL_SCANCODE_S, 0x8}, {SDL_SCANCODE_D, 0x9}, {SDL_SCANCODE_F, 0xE},
+    {SDL_SCANCODE_Z, 0xA}, {SDL_SCANCODE_X, 0x0}, {SDL_SCANCODE_C, 0xB}, {SDL_SCANCODE_V, 0xF},
+};
+
+/**
+ * Maps an SDL scancode to a Chip8 key.
+ * @return The key, or -1 if the scancode is not mapped.
+ */
+int toChip8Key(SDL_Scancode scancode)
+{
+    for (const KeyBinding& binding : KEY_BINDINGS)
+    {
+        if (binding.scancode == scancode)
+        {
+            return binding.key;
+        }
+    }
+    return -1;
+}
+} // namespace
+
+void Chip8Input::pollEvents(chip8core::Chip8InputQueue& queue, bool& running,
+                            chip8core::Chip8LatencyTracker* latency)
 {
+    // SDL stamps events in milliseconds of SDL_GetTicks(); rebase them onto Chip8Stats::now()
+    uint64_t now   = chip8core::Chip8Stats::now();
+    Uint32   ticks = SDL_GetTicks();
+
     SDL_Event e;
     while (SDL_PollEvent(&e))
     {
@@ -17,26 +57,26 @@ void Chip8Input::pollEvents(chip8core::Chip8InputBuffer& input, bool& running)
             running = false;
             return;
         }
-    }
+        if ((e.type != SDL_KEYDOWN && e.type != SDL_KEYUP) || e.key.repeat)
+        {
+            continue;
+        }
 
-    // Poll the current state of all keys
-    const Uint8* state = SDL_GetKeyboardState(NULL);
-
-    // Map SDL scancodes to Chip8 keys
-    input.setKeyState(0x1, state[SDL_SCANCODE_1]);
-    input.setKeyState(0x2, state[SDL_SCANCODE_2]);
-    input.setKeyState(0x3, state[SDL_SCANCODE_3]);
-    input.setKeyState(0xC, state[SDL_SCANCODE_4]);
-    input.setKeyState(0x4, state[SDL_SCANCODE_Q]);
-    input.setKeyState(0x5, state[SDL_SCANCODE_W]);
-    input.setKeyState(0x6, state[SDL_SCANCODE_E]);
-    input.setKeyState(0xD, state[SDL_SCANCODE_R]);
-    input.setKeyState(0x7, state[SDL_SCANCODE_A]);
-    input.setKeyState(0x8, state[SDL_SCANCODE_S]);
-    input.setKeyState(0x9, state[SDL_SCANCODE_D]);
-    input.setKeyState(0xE, state[SDL_SCANCODE_F]);
-    input.setKeyState(0xA, state[SDL_SCANCODE_Z]);
-    input.setKeyState(0x0, state[SDL_SCANCODE_X]);
-    input.setKeyState(0xB, state[SDL_SCANCODE_C]);
-    input.setKeyState(0xF, state[SDL_SCANCODE_V]);
-}
\ No newline at end of file
+        int key = toChip8Key(e.key.keysym.scancode);
+        if (key < 0)
+        {
+            continue;
+        }
+        Uint32   age       = ticks > e.key.timestamp ? ticks - e.key.timestamp : 0;
+        uint64_t timestamp = now - static_cast<uint64_t>(age) * 1000000;
+        if (!queue.push({timestamp, static_cast<uint8_t>(key), e.type == SDL_KEYDOWN}))
+        {
+            spdlog::warn("Input queue full, dropped key 0x{:X}", key);
+            continue;
+        }
+        if (latency)
+        {
+            latency->onKeyTransition(timestamp);
+        }
+    }
+}
@@ -1,24 +1,99 @@
 #include <SDL2/SDL.h>
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
 #include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8FramePacer.h"
+#include "Chip8Core/Chip8LatencyTracker.h"
+#include "Chip8Core/Chip8Movie.h"
 #include "Chip8Core/Chip8Timer.h"
+#include "Chip8Core/Chip8TripleBuffer.h"
 #include "Chip8Emulator/Chip8Audio.h"
 #include "Chip8Emulator/Chip8Display.h"
 #include "Chip8Emulator/Chip8Input.h"
 #include "Chip8Emulator/Chip8ROMLoader.h"
 
-chip8core::Chip8 chip8;
-Chip8Display     display(64, 32, 10);
-Chip8Input       input;
-Chip8Audio       audio;
-bool             running        = true;
-const int        cyclesPerFrame = 10;
+chip8core::Chip8            chip8;
+Chip8Display                display(64, 32, 10);
+Chip8Input                  input;
+std::unique_ptr<Chip8Audio> audio;
+bool                        running              = true;
+std::atomic<bool>           emulating{true};
+const int                   audioSyncSamples     = 128;    // Device buffer for --audio-sync
+const long                  MAX_CYCLES_PER_FRAME = 100000; // --ipf limit, a 6MHz CPU
 
-int main()
+chip8core::Chip8InputQueue inputQueue; // SDL key events, applied by chip8.cycle()
+
+// Changed frames, from the emulation thread to the presentation thread
+chip8core::Chip8TripleBuffer<chip8core::Chip8GraphicsBuffer> frames;
+chip8core::Chip8FramePacer                                   pacer; // Refresh set before emulate()
+
+/**
+ * Emulation thread: runs the machine and audio clock and publishes every
+ * changed frame. It owns chip8 until joined; of its stats it writes only the
+ * emulation and audio fields, leaving frame and render fields to main().
+ */
+void emulate(bool audioSync)
+{
+    chip8core::Chip8Stats& stats         = chip8.getStats();
+    uint64_t               publishedHash = ~chip8.getGraphics().getHash(); // Publish frame one
+    while (emulating)
+    {
+        // One refresh period of emulated time, or what the audio clock asks for. Turbo
+        // speeds run on the host clock instead; the audio clock ignores them.
+        uint64_t emulateStart = chip8core::Chip8Stats::now();
+        uint64_t owed         = pacer.beginFrame(emulateStart, stats);
+        bool     turbo        = !audioSync && chip8.getSpeed() != 1.0;
+        uint64_t target       = chip8.getEmulatedClock() + owed;
+        if (audioSync)
+        {
+            target = audio->getTargetCycle();
+        }
+        int executed = turbo ? chip8.cycle() : chip8.cycleUntil(target);
+
+        uint64_t audioStart = chip8core::Chip8Stats::now();
+        audio->processAudio(chip8);
+        stats.audioNs += chip8core::Chip8Stats::now() - audioStart;
+        stats.emulateTime.record(audioStart - emulateStart);
+
+        const chip8core::Chip8GraphicsBuffer& graphics = chip8.getGraphics();
+        if (!graphics.isSameFrame(publishedHash))
+        {
+            frames.back() = graphics;
+            frames.publish();
+            publishedHash = graphics.getHash();
+        }
+        else if (executed > 0)
+        {
+            ++stats.framesSkipped;
+        }
+
+        if (chip8.getSpeed() != chip8core::Chip8::UNLIMITED || audioSync)
+        {
+            pacer.sleepUntilDeadline();
+        }
+    }
+}
+
+/**
+ * Runs the emulator. `--record <file>` saves the session as an input movie
+ * that Chip8Farm or the benchmarks can replay exactly. `--audio-sync` paces
+ * the emulation by the audio device clock instead of the host clock, which
+ * keeps sound and emulation from drifting apart and allows a smaller buffer.
+ * `--ipf <n>` sets the instructions per 60Hz frame (default 700Hz, about 11.7)
+ * and `--speed <x>` runs x times real time, or as fast as possible for 0.
+ */
+int main(int argc, char** argv)
 {
     if (SDL_Init(SDL_INIT_AUDIO) < 0)
     {
@@ -27,25 +102,120 @@ int main()
     spdlog::set_level(spdlog::level::debug);
     spdlog::info("Application Started");
 
-    Chip8ROMLoader::loadROM("../../../roms/6-keypad.ch8", chip8);
+    std::string moviePath;
+    bool        audioSync = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc)
+        {
+            moviePath = argv[++i];
+        }
+        else if (arg == "--audio-sync")
+        {
+            audioSync = true;
+        }
+        else if (arg == "--ipf" && i + 1 < argc)
+        {
+            const char* value = argv[++i];
+            char*       end   = nullptr;
+            long        ipf   = std::strtol(value, &end, 10);
+            if (end == value || *end != '\0' || ipf < 1 || ipf > MAX_CYCLES_PER_FRAME)
+            {
+                spdlog::error("Invalid --ipf '{}', expected 1 to {}; keeping {}Hz", value,
+                              MAX_CYCLES_PER_FRAME, chip8.getCpuHz());
+                continue;
+            }
+            chip8.setCyclesPerFrame(static_cast<int>(ipf));
+        }
+        else if (arg == "--speed" && i + 1 < argc)
+        {
+            const char* value = argv[++i];
+            char*       end   = nullptr;
+            double      speed = std::strtod(value, &end);
+            if (end == value || *end != '\0' || !(speed >= 0.0) || std::isinf(speed))
+            {
+                spdlog::error("Invalid --speed '{}', expected 0 or more; keeping {}x", value,
+                              chip8.getSpeed());
+                continue;
+            }
+            chip8.setSpeed(speed);
+        }
+    }
+    int samples = audioSync ? audioSyncSamples : Chip8Audio::DEFAULT_SAMPLES;
+    audio       = std::make_unique<Chip8Audio>(samples);
+    if (audioSync && !audio->isOpen())
+    {
+        // The audio clock would never advance and the emulation would freeze
+        spdlog::warn("No audio device; --audio-sync ignored, pacing by the host clock");
+        audioSync = false;
+    }
+
+    const std::string romPath = "../../../roms/6-keypad.ch8";
+    Chip8ROMLoader::loadROM(romPath, chip8);
+
+    // Keys are recorded by cycle number from here on, right after reset and load
+    std::unique_ptr<chip8core::Chip8MovieRecorder> recorder;
+    if (!moviePath.empty())
+    {
+        recorder = std::make_unique<chip8core::Chip8MovieRecorder>(chip8);
+        chip8.setInputObserver(recorder.get());
+    }
+    chip8.attachInputQueue(&inputQueue);
+    chip8.attachSoundQueue(&audio->getSoundQueue());
 
+    // Emulation runs on its own thread paced to the display; this one does events and presents
+    pacer.setRefreshRate(display.getRefreshRate());
+    std::thread emulator(emulate, audioSync);
+
+    chip8core::Chip8Stats&         stats = chip8.getStats();
+    chip8core::Chip8LatencyTracker latency;
+    uint64_t                       presentedAt = chip8core::Chip8Stats::now();
     while (running)
     {
         // Poll for input
-        input.pollEvents(chip8.getInput(), running);
+        input.pollEvents(inputQueue, running, &latency);
+
+        // Present the newest frame, if the emulation published one
+        const chip8core::Chip8GraphicsBuffer* frame = frames.acquire();
+        if (frame == nullptr)
+        {
+            // Sleep until the next vsync is due, waking early for input
+            uint64_t now    = chip8core::Chip8Stats::now();
+            uint64_t period = pacer.getPeriodNs();
+            uint64_t vsync  = presentedAt + period * ((now - presentedAt) / period + 1);
+            latency.onFrame(frames.front(), now); // Times out stale keys
+            SDL_WaitEventTimeout(nullptr, static_cast<int>((vsync - now) / 1000000) + 1);
+            continue;
+        }
 
-        // Cycle Chip8
-        chip8.cycle();
+        uint64_t renderStart = chip8core::Chip8Stats::now();
+        display.draw(*frame);
+        uint64_t presentStart = chip8core::Chip8Stats::now();
+        display.present(); // Waits for vsync
+        uint64_t presentEnd = chip8core::Chip8Stats::now();
+        latency.onFrame(*frame, presentEnd);
+        pacer.onVsync(presentEnd);
 
-        // Render display
-        display.render(chip8.getGraphics());
+        stats.renderNs += presentEnd - renderStart;
+        stats.renderTime.record(presentStart - renderStart);
+        stats.presentTime.record(presentEnd - presentStart);
+        stats.recordFrame(presentEnd - presentedAt, true);
+        presentedAt = presentEnd;
+    }
 
-        // Play audio
-        audio.processAudio(chip8.getSoundTimer());
+    emulating = false;
+    emulator.join();
 
-        // Delay SDL
-        SDL_Delay(1);
+    if (recorder && recorder->finish(chip8).save(moviePath))
+    {
+        spdlog::info("Recorded movie: {}", moviePath);
     }
+
+    std::ostringstream report;
+    stats.dumpText(report, romPath + " (native)");
+    latency.dumpText(report);
+    spdlog::info("\n{}", report.str());
     spdlog::info("Application Ended");
     return 0;
 }
\ No newline at end of file
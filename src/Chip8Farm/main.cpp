@@ -0,0 +1,191 @@
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Chip8Core/Chip8Farm.h"
+#include "Chip8Core/Chip8Lockstep.h"
+
+namespace fs = std::filesystem;
+
+namespace
+{
+void printUsage()
+{
+    std::cerr << "Usage: Chip8Farm <rom-dir> [options]\n"
+                 "  --golden <file>      Golden hashes (default <rom-dir>/golden.txt)\n"
+                 "  --update             Rewrite the golden file from this run\n"
+                 "  --frames <n>         Frames to run per ROM (default 600)\n"
+                 "  --cycles <n>         Instructions per frame (default 10)\n"
+                 "  --checkpoint <n>     Hash the framebuffer every n frames (default 60)\n"
+                 "  --seed <n>           Random seed (default 1)\n"
+                 "  --threads <n>        Worker threads (default one per core)\n"
+                 "  --tap-keys           Tap every key in turn for ROMs without input\n";
+}
+} // namespace
+
+/**
+ * Runs every .ch8 ROM in a directory headless and checks its framebuffer at
+ * fixed checkpoints against golden hashes, e.g. `Chip8Farm roms` in CI or
+ * `Chip8Farm roms --update` after an intended behaviour change. A ROM's input
+ * comes from a `<rom>.c8m` movie next to it, replayed at full speed, or else
+ * a `<rom>.keys` script with one "frame mask" line per event. A ROM that
+ * runs into an invalid opcode is reported as FAULT and never hashed, so
+ * `--update` leaves it out and a later check reports it without failing.
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        printUsage();
+        return 1;
+    }
+
+    fs::path                    romDir     = argv[1];
+    fs::path                    goldenPath = romDir / "golden.txt";
+    bool                        update     = false;
+    bool                        tapKeys    = false;
+    chip8core::Chip8FarmOptions options;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--update")
+        {
+            update = true;
+            continue;
+        }
+        if (arg == "--tap-keys")
+        {
+            tapKeys = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (arg == "--golden")
+            goldenPath = value;
+        else if (arg == "--frames")
+            options.frames = std::atoi(value);
+        else if (arg == "--cycles")
+            options.cyclesPerFrame = std::atoi(value);
+        else if (arg == "--checkpoint")
+            options.checkpointEvery = std::atoi(value);
+        else if (arg == "--seed")
+            options.seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 0));
+        else if (arg == "--threads")
+            options.threads = std::strtoul(value, nullptr, 0);
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    spdlog::set_level(spdlog::level::warn);
+
+    std::vector<fs::path> romPaths;
+    std::error_code       error;
+    for (const auto& entry : fs::directory_iterator(romDir, error))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".ch8")
+        {
+            romPaths.push_back(entry.path());
+        }
+    }
+    if (error || romPaths.empty())
+    {
+        spdlog::error("No ROMs found in {}", romDir.string());
+        return 1;
+    }
+    std::sort(romPaths.begin(), romPaths.end());
+
+    std::vector<chip8core::Chip8FarmJob> jobs;
+    for (const fs::path& romPath : romPaths)
+    {
+        chip8core::Chip8FarmJob job;
+        job.name = romPath.filename().string();
+
+        std::ifstream file(romPath, std::ios::binary);
+        job.rom.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+        fs::path      sidecarPath = romPath;
+        std::ifstream keys(sidecarPath.replace_extension(".keys"));
+        if (fs::exists(sidecarPath.replace_extension(".c8m")))
+        {
+            if (!job.movie.load(sidecarPath.string()))
+                return 1;
+        }
+        else if (keys)
+            job.input = chip8core::readInputScript(keys);
+        else if (tapKeys)
+            job.input = chip8core::Chip8Lockstep::tapEveryKey(options.frames);
+        jobs.push_back(std::move(job));
+    }
+
+    std::vector<chip8core::Chip8FarmResult> results = chip8core::Chip8Farm(options).run(jobs);
+
+    if (update)
+    {
+        std::ofstream out(goldenPath);
+        chip8core::Chip8Farm::writeGolden(out, results);
+        size_t faulted = 0;
+        for (const chip8core::Chip8FarmResult& result : results)
+        {
+            if (!result.error.empty())
+            {
+                std::cout << "FAULT " << result.name << ": " << result.error << " (left out)\n";
+                ++faulted;
+            }
+        }
+        std::cout << "Wrote golden hashes of " << results.size() - faulted << " ROMs to "
+                  << goldenPath.string() << "\n";
+        return 0;
+    }
+
+    std::ifstream goldenFile(goldenPath);
+    if (!goldenFile)
+    {
+        spdlog::error("Failed to read golden file: {} (run with --update to create it)",
+                      goldenPath.string());
+        return 1;
+    }
+    chip8core::Chip8GoldenHashes golden = chip8core::Chip8Farm::readGolden(goldenFile);
+
+    size_t failed  = 0;
+    size_t faulted = 0;
+    for (const chip8core::Chip8FarmResult& result : results)
+    {
+        // A ROM known to fault is kept out of the golden file; report it, but only fail
+        // ROMs whose golden run it no longer matches
+        if (!result.error.empty() && golden.count(result.name) == 0)
+        {
+            std::cout << "FAULT " << result.name << ": " << result.error << " (no golden hashes)\n";
+            ++faulted;
+            continue;
+        }
+        std::vector<std::string> mismatches = chip8core::Chip8Farm::compare(result, golden);
+        std::cout << (mismatches.empty() ? "PASS " : "FAIL ") << result.name << "\n";
+        for (const std::string& mismatch : mismatches)
+        {
+            std::cout << "    " << mismatch << "\n";
+        }
+        failed += mismatches.empty() ? 0 : 1;
+    }
+    size_t checked = results.size() - faulted;
+    std::cout << checked - failed << "/" << checked << " ROMs match";
+    if (faulted > 0)
+    {
+        std::cout << ", " << faulted << " faulted without golden hashes";
+    }
+    std::cout << "\n";
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+#include <spdlog/spdlog.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8StackProfiler.h"
+#include "Chip8Core/Chip8Symbols.h"
+
+namespace
+{
+void printUsage()
+{
+    std::cerr << "Usage: Chip8Profile <rom.ch8> [options]\n"
+                 "  --symbols <file>     Labels from an Octo .8o source or an address map\n"
+                 "  --frames <n>         Frames to run (default 600)\n"
+                 "  --cycles <n>         Instructions per frame (default 10)\n"
+                 "  --interval <n>       Sample every n instructions (default 97)\n"
+                 "  --keys <mask>        Held keys as a 16-bit mask, bit k for key k\n"
+                 "  --seed <n>           Random seed (default 0)\n"
+                 "  --out <file>         Write folded stacks to a file instead of stdout\n";
+}
+} // namespace
+
+/**
+ * Runs a ROM headless and writes its sampled guest call stacks in folded
+ * format, e.g. `Chip8Profile game.ch8 --symbols game.8o | flamegraph.pl > game.svg`.
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::string romPath = argv[1];
+    std::string symbolsPath;
+    std::string outPath;
+    int         frames   = 600;
+    int         cycles   = 10;
+    uint32_t    interval = 97;
+    uint16_t    keys     = 0;
+    uint32_t    seed     = 0;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            printUsage();
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (arg == "--symbols")
+            symbolsPath = value;
+        else if (arg == "--frames")
+            frames = std::atoi(value);
+        else if (arg == "--cycles")
+            cycles = std::atoi(value);
+        else if (arg == "--interval")
+            interval = static_cast<uint32_t>(std::strtoul(value, nullptr, 0));
+        else if (arg == "--keys")
+            keys = static_cast<uint16_t>(std::strtoul(value, nullptr, 0));
+        else if (arg == "--seed")
+            seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 0));
+        else if (arg == "--out")
+            outPath = value;
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    spdlog::set_level(spdlog::level::warn);
+
+    std::ifstream        file(romPath, std::ios::binary);
+    std::vector<uint8_t> rom((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+    if (rom.empty())
+    {
+        spdlog::error("Failed to read ROM file: {}", romPath);
+        return 1;
+    }
+
+    chip8core::Chip8Symbols symbols;
+    if (!symbolsPath.empty() && !symbols.load(symbolsPath))
+    {
+        return 1;
+    }
+
+    chip8core::Chip8 chip8;
+    chip8.setSeed(seed);
+    chip8.reset();
+    chip8.loadROM(rom.data(), rom.size());
+    chip8.getInput().setKeyMask(keys);
+
+    chip8core::Chip8StackProfiler profiler(interval);
+    try
+    {
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            for (int i = 0; i < cycles; ++i)
+            {
+                chip8.step();
+                profiler.onInstruction(chip8);
+            }
+            chip8.updateTimers();
+        }
+    }
+    catch (const std::exception& e)
+    {
+        spdlog::error("Emulation stopped at PC 0x{:03X}: {}", chip8.getCPU().getPC(), e.what());
+    }
+
+    const chip8core::Chip8Symbols* labels = symbols.empty() ? nullptr : &symbols;
+    if (outPath.empty())
+    {
+        profiler.writeFolded(std::cout, labels);
+    }
+    else
+    {
+        std::ofstream out(outPath);
+        profiler.writeFolded(out, labels);
+    }
+    return 0;
+}
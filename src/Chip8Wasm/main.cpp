@@ -4,9 +4,13 @@
 #include <spdlog/spdlog.h>
 
 #include <fstream>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8FramePacer.h"
+#include "Chip8Core/Chip8LatencyTracker.h"
 #include "Chip8Core/Chip8Timer.h"
 #include "Chip8Emulator/Chip8Audio.h"
 #include "Chip8Emulator/Chip8Display.h"
@@ -19,24 +23,126 @@ Chip8Input       input;
 Chip8Audio*      audio          = nullptr;
 bool             running        = true;
 bool             romLoaded      = false;
-const int        cyclesPerFrame = 10;
+bool             hidden         = false; // The page is in a background tab or minimised
+uint64_t         frameStart     = 0;
+uint64_t         shownHash      = 0; // Chip8GraphicsBuffer::getHash() of the frame on screen
+uint32_t         generation     = 0; // Bumped after every frame that ran, see get_state_layout
+std::string      romName;
+
+chip8core::Chip8LatencyTracker latency;
+chip8core::Chip8InputQueue     inputQueue;
+chip8core::Chip8FramePacer     pacer; // Cycles owed per requestAnimationFrame timestamp
+
+constexpr size_t MAX_ROM_BYTES = chip8core::Chip8Memory::MEMORY_SIZE - 0x200; // Loaded at 0x200
 
 void initAudio()
 {
-    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) >= 0)
+    // Opened once, on the first ROM load, which follows a click so the browser allows sound
+    if (audio == nullptr && SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) >= 0)
     {
         audio = new Chip8Audio();
+        chip8.attachSoundQueue(&audio->getSoundQueue());
     }
 }
 
+/**
+ * Starts the ROM just loaded into the reset machine. The audio device, speed
+ * settings and input queue carry over, so switching ROMs is instant.
+ */
+void startROM(const std::string& name)
+{
+    romLoaded = true;
+    romName   = name;
+    shownHash = ~chip8.getGraphics().getHash(); // Always draw the first frame
+    ++generation;
+    pacer.pause(); // The new ROM starts from the next frame, without catch-up
+    initAudio();
+    spdlog::info("ROM loaded: {}", name);
+}
+
 extern "C"
 {
     EMSCRIPTEN_KEEPALIVE
     void load_rom(const char* filename)
     {
+        chip8.reset();
         romLoaded = Chip8ROMLoader::loadROM(filename, chip8);
-        spdlog::info("ROM loaded: {}", filename);
-        initAudio();
+        if (romLoaded)
+        {
+            startROM(filename);
+        }
+    }
+
+    /**
+     * Resets the machine and loads a ROM straight from the WASM heap, e.g. a
+     * Uint8Array passed with ccall's 'array' type, without the virtual filesystem.
+     * Returns 1 on success, 0 if the ROM does not fit in memory.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    int load_rom_bytes(const uint8_t* data, size_t length)
+    {
+        if (length > MAX_ROM_BYTES)
+        {
+            spdlog::error("ROM of {} bytes does not fit in {} bytes of memory", length,
+                          MAX_ROM_BYTES);
+            return 0;
+        }
+        chip8.reset();
+        chip8.loadROM(data, length);
+        startROM(fmt::format("rom ({} bytes)", length));
+        return 1;
+    }
+
+    /**
+     * Sets the instructions run per 60Hz frame; the timers keep 60Hz either way.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    void set_cycles_per_frame(int cycles)
+    {
+        chip8.setCyclesPerFrame(cycles);
+    }
+
+    /**
+     * Sets the turbo multiplier: 1 for real time, 0 for as fast as possible.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    void set_speed(double speed)
+    {
+        chip8.setSpeed(speed);
+    }
+
+    /**
+     * Returns a pointer to the heap addresses of the live machine state, as uint32:
+     * [0] framebuffer, 32 rows of 64 pixels in little-endian uint64 words with
+     *     pixel x in bit 63 - x, so as a Uint32Array row y holds pixels 0-31 in
+     *     element 2y + 1 and 32-63 in element 2y, leftmost in the top bit,
+     * [1] memory, 4096 bytes, [2] V0-VF, 16 bytes, [3] I, uint16, [4] PC, uint16,
+     * [5] SP, byte, [6] stack, 16 uint16, [7] delay timer, byte, [8] sound timer,
+     * byte, [9] generation, uint32, bumped after every frame that ran instructions.
+     * The state lives in globals and the heap does not grow, so typed-array views
+     * built once stay valid and are read each frame without calls or copies.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    const uint32_t* get_state_layout()
+    {
+        static uint32_t layout[10];
+
+        auto address = [](const void* pointer)
+        {
+            return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pointer));
+        };
+        const chip8core::Chip8CPUStateView cpu = chip8.getCPU().getStateView();
+        layout[0] = address(chip8.getGraphics().data());
+        layout[1] = address(chip8.getMemory().data());
+        layout[2] = address(cpu.v);
+        layout[3] = address(cpu.i);
+        layout[4] = address(cpu.pc);
+        layout[5] = address(cpu.sp);
+        layout[6] = address(cpu.stack);
+        layout[7] = address(chip8.getDelayTimer().data());
+        layout[8] = address(chip8.getSoundTimer().data());
+        layout[9] = address(&generation);
+        return layout;
     }
 
     EMSCRIPTEN_KEEPALIVE
@@ -48,23 +154,163 @@ extern "C"
             info[i + 1] = chip8.getCPU().getV(i);
         return info;
     }
+
+    /**
+     * Returns a pointer to performance counters as doubles:
+     * [0] instructions, [1] emulate ns, [2] render ns, [3] audio ns,
+     * [4] cycles caught up, [5] cycles dropped, [6] frames rendered,
+     * [7] frames skipped, [8] frame time p50 ms, [9] frame time p99 ms,
+     * [10] frame time max ms, [11] frame-time bucket width ms,
+     * [12] bucket count B, [13 .. 13+B] bucket counts, the last one overflow.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    const double* get_stats()
+    {
+        constexpr size_t BUCKETS = chip8core::Chip8Stats::FRAME_BUCKET_COUNT + 1;
+        static double    info[13 + BUCKETS];
+
+        const chip8core::Chip8Stats& stats = chip8.getStats();
+        info[0]  = stats.instructions;
+        info[1]  = stats.emulateNs;
+        info[2]  = stats.renderNs;
+        info[3]  = stats.audioNs;
+        info[4]  = stats.cyclesCaughtUp;
+        info[5]  = stats.cyclesDropped;
+        info[6]  = stats.framesRendered;
+        info[7]  = stats.framesSkipped;
+        info[8]  = stats.frameTime.percentile(0.5) / 1e6;
+        info[9]  = stats.frameTime.percentile(0.99) / 1e6;
+        info[10] = stats.frameTime.getMax() / 1e6;
+        info[11] = stats.frameTime.getBucketWidth() / 1e6;
+        info[12] = BUCKETS;
+        for (size_t i = 0; i < BUCKETS; ++i)
+            info[13 + i] = stats.frameTime.getBuckets()[i];
+        return info;
+    }
+
+    /**
+     * Returns a pointer to latency and frame-phase percentiles as doubles:
+     * [0] key transitions, [1] unanswered transitions, [2] latency samples,
+     * [3] input latency p50 ms, [4] p99 ms, [5] max ms, then p50 and p99 in
+     * ms of [6-7] emulate, [8-9] render and [10-11] present per frame.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    const double* get_latency_stats()
+    {
+        static double info[12];
+
+        const chip8core::Chip8Stats&     stats     = chip8.getStats();
+        const chip8core::Chip8Histogram& histogram = latency.getLatency();
+        info[0]  = latency.getTransitionCount();
+        info[1]  = latency.getUnansweredCount();
+        info[2]  = histogram.getCount();
+        info[3]  = histogram.percentile(0.5) / 1e6;
+        info[4]  = histogram.percentile(0.99) / 1e6;
+        info[5]  = histogram.getMax() / 1e6;
+        info[6]  = stats.emulateTime.percentile(0.5) / 1e6;
+        info[7]  = stats.emulateTime.percentile(0.99) / 1e6;
+        info[8]  = stats.renderTime.percentile(0.5) / 1e6;
+        info[9]  = stats.renderTime.percentile(0.99) / 1e6;
+        info[10] = stats.presentTime.percentile(0.5) / 1e6;
+        info[11] = stats.presentTime.percentile(0.99) / 1e6;
+        return info;
+    }
+
+    EMSCRIPTEN_KEEPALIVE
+    void reset_stats()
+    {
+        chip8.getStats().reset();
+        latency.reset();
+    }
+
+    /**
+     * Logs the full performance report of the loaded ROM to the console.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    void log_stats()
+    {
+        std::ostringstream report;
+        chip8.getStats().dumpText(report, romName + " (wasm)");
+        latency.dumpText(report);
+        spdlog::info("\n{}", report.str());
+    }
+}
+
+/**
+ * Stops the emulated clock while the page is hidden. Browsers stop or throttle
+ * requestAnimationFrame then, and the time away must not come back as a burst
+ * of catch-up cycles or as dropped frames.
+ */
+EM_BOOL onVisibilityChange(int eventType, const EmscriptenVisibilityChangeEvent* event,
+                           void* userData)
+{
+    hidden = event->hidden;
+    if (hidden)
+    {
+        pacer.pause();
+        frameStart = 0;
+    }
+    if (audio)
+    {
+        audio->setPaused(hidden);
+    }
+    return EM_FALSE;
 }
 
+/**
+ * One display refresh. The rAF timestamp, in milliseconds, drives a fixed-step
+ * scheduler: the frame runs the whole 700Hz cycles owed since the previous
+ * timestamp, so 60, 120 and 144Hz displays all run at real time.
+ */
 bool emulationIteration(double time, void* userData)
 {
-    if (romLoaded)
+    if (romLoaded && !hidden)
     {
         // Poll for input
-        input.pollEvents(chip8.getInput(), running);
+        input.pollEvents(inputQueue, running, &latency);
 
-        // Cycle Chip8
-        chip8.cycle();
+        // Cycle Chip8 for the time since the last vsync; turbo speeds run on the host clock
+        uint64_t emulateStart = chip8core::Chip8Stats::now();
+        uint64_t vsyncNs      = static_cast<uint64_t>(time * 1e6);
+        uint64_t owed         = pacer.beginFrameAt(vsyncNs, chip8.getStats());
+        uint64_t target       = chip8.getEmulatedClock() + owed;
+        int      executed     = chip8.getSpeed() == 1.0 ? chip8.cycleUntil(target) : chip8.cycle();
 
-        // Render display
-        display.render(chip8.getGraphics());
+        // Render display, unless the frame is identical to the one on screen
+        const chip8core::Chip8GraphicsBuffer& graphics    = chip8.getGraphics();
+        bool                                  changed     = !graphics.isSameFrame(shownHash);
+        uint64_t                              renderStart = chip8core::Chip8Stats::now();
+        if (changed)
+        {
+            display.draw(graphics);
+        }
+        uint64_t presentStart = chip8core::Chip8Stats::now();
+        if (changed)
+        {
+            display.present();
+            shownHash = graphics.getHash();
+        }
+        if (executed > 0)
+        {
+            latency.onFrame(graphics, chip8core::Chip8Stats::now());
+            ++generation;
+        }
 
         // Play audio
-        audio->processAudio(chip8.getSoundTimer());
+        uint64_t audioStart = chip8core::Chip8Stats::now();
+        audio->processAudio(chip8);
+
+        uint64_t               frameEnd = chip8core::Chip8Stats::now();
+        chip8core::Chip8Stats& stats    = chip8.getStats();
+        stats.renderNs += audioStart - renderStart;
+        stats.audioNs += frameEnd - audioStart;
+        stats.recordPhases(renderStart - emulateStart, presentStart - renderStart,
+                           audioStart - presentStart);
+        if (frameStart != 0)
+        {
+            stats.recordFrame(frameEnd - frameStart, changed);
+        }
+        frameStart = frameEnd;
     }
 
     return EM_TRUE;
@@ -75,6 +321,8 @@ int main()
     spdlog::set_level(spdlog::level::debug);
     spdlog::info("Application Started");
 
+    chip8.attachInputQueue(&inputQueue);
+    emscripten_set_visibilitychange_callback(nullptr, EM_FALSE, onVisibilityChange);
     emscripten_request_animation_frame_loop(emulationIteration, 0);
 
     emscripten_exit_with_live_runtime();
@@ -0,0 +1,152 @@
+#include <emscripten.h>
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <thread>
+
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8FramePacer.h"
+#include "Chip8Core/Chip8SharedState.h"
+
+/*
+ * Chip8Wasm built with pthreads: the machine runs on its own thread, a Web
+ * Worker, and everything the page needs lives in a Chip8SharedState on the
+ * heap, which is a SharedArrayBuffer in this build. The page only draws the
+ * frame, sets the key mask and plays the sound edges, so a busy main thread
+ * can delay drawing but never the emulation. Pages need cross-origin
+ * isolation (COOP and COEP headers) to get a SharedArrayBuffer; Node does not.
+ */
+
+chip8core::Chip8            chip8;
+chip8core::Chip8SharedState shared;
+chip8core::Chip8InputQueue  inputQueue; // Fed from shared key mask changes on the emulation thread
+chip8core::Chip8SoundQueue  soundQueue; // Drained into the shared edge ring every frame
+std::thread                 emulator;
+
+constexpr size_t MAX_ROM_BYTES = chip8core::Chip8Memory::MEMORY_SIZE - 0x200; // Loaded at 0x200
+
+/**
+ * Emulation thread: runs 60Hz frames on the host clock until the page clears
+ * the running word, publishing each changed frame and every sound edge.
+ */
+void emulate()
+{
+    chip8core::Chip8FramePacer pacer(chip8core::Chip8::TIMER_HZ);
+    chip8core::Chip8Stats&     stats         = chip8.getStats();
+    uint64_t                   publishedHash = ~chip8.getGraphics().getHash(); // Publish frame one
+    uint16_t                   keys          = 0;
+    while (shared.isRunning())
+    {
+        // Turn key mask changes into timestamped events, as the SDL frontends do
+        uint64_t frameStart = chip8core::Chip8Stats::now();
+        uint16_t mask       = shared.getKeyMask();
+        for (uint8_t key = 0; key < 16 && mask != keys; ++key)
+        {
+            if (((mask ^ keys) >> key) & 1)
+            {
+                inputQueue.push({frameStart, key, ((mask >> key) & 1) != 0});
+            }
+        }
+        keys = mask;
+
+        uint64_t owed = pacer.beginFrame(frameStart, stats);
+        chip8.cycleUntil(chip8.getEmulatedClock() + owed);
+
+        chip8core::Chip8SoundEdge edge;
+        while (soundQueue.peek(edge))
+        {
+            shared.publishEdge(edge);
+            soundQueue.pop();
+        }
+        shared.setClock(chip8.getEmulatedClock());
+        if (!chip8.getGraphics().isSameFrame(publishedHash))
+        {
+            shared.publishFrame(chip8.getGraphics());
+            publishedHash = chip8.getGraphics().getHash();
+        }
+        stats.emulateTime.record(chip8core::Chip8Stats::now() - frameStart);
+
+        pacer.sleepUntilDeadline();
+    }
+}
+
+void stopEmulation()
+{
+    shared.setRunning(false);
+    if (emulator.joinable())
+    {
+        emulator.join();
+    }
+}
+
+extern "C"
+{
+    /**
+     * Returns the heap address of the Chip8SharedState. Read it as a Uint32Array
+     * of Chip8SharedState::WORDS words at the offsets returned by get_shared_layout.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    const void* get_shared_state()
+    {
+        return shared.data();
+    }
+
+    /**
+     * Returns a pointer to the layout of the shared state as uint32 word offsets:
+     * [0] frame sequence, [1] key mask, [2] running, [3] edge count, [4] clock,
+     * [5] frame, [6] edges, [7] total words, [8] edge capacity, [9] words per edge.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    const uint32_t* get_shared_layout()
+    {
+        using State = chip8core::Chip8SharedState;
+        static const uint32_t layout[] = {
+            State::FRAME_SEQUENCE, State::KEY_MASK, State::RUNNING,       State::EDGE_COUNT,
+            State::CLOCK,          State::FRAME,    State::EDGES,         State::WORDS,
+            State::EDGE_CAPACITY,  State::EDGE_WORDS};
+        return layout;
+    }
+
+    /**
+     * Stops the emulation thread, loads a ROM from the heap into the reset
+     * machine and starts the thread again. Returns 1 on success, 0 if the
+     * ROM does not fit in memory.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    int start_rom_bytes(const uint8_t* data, size_t length)
+    {
+        if (length > MAX_ROM_BYTES)
+        {
+            spdlog::error("ROM of {} bytes does not fit in {} bytes of memory", length,
+                          MAX_ROM_BYTES);
+            return 0;
+        }
+        stopEmulation();
+        chip8.reset();
+        chip8.loadROM(data, length);
+        shared.setRunning(true);
+        emulator = std::thread(emulate);
+        spdlog::info("ROM started on the emulation thread: {} bytes", length);
+        return 1;
+    }
+
+    /**
+     * Stops the emulation thread; the page may also clear the running word itself.
+     */
+    EMSCRIPTEN_KEEPALIVE
+    void stop()
+    {
+        stopEmulation();
+    }
+}
+
+int main()
+{
+    spdlog::set_level(spdlog::level::debug);
+    spdlog::info("Application Started (worker)");
+
+    chip8.attachInputQueue(&inputQueue);
+    chip8.attachSoundQueue(&soundQueue);
+    emscripten_exit_with_live_runtime();
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Chip8Core/Chip8Batch.h"
+#include "Chip8Core/Chip8CPU.h"
+
+// Test that every lane starts at the program area with the font loaded.
+TEST(Chip8BatchTest, ResetInitializesAllLanes)
+{
+    chip8core::Chip8Batch batch(4);
+    ASSERT_EQ(batch.size(), 4u);
+    for (size_t lane = 0; lane < batch.size(); ++lane)
+    {
+        EXPECT_EQ(batch.getPC(lane), 0x200);
+        EXPECT_EQ(batch.getSP(lane), 0);
+        EXPECT_EQ(batch.getI(lane), 0);
+        for (int i = 0; i < chip8core::Chip8CPU::FONT_BYTES; ++i)
+        {
+            EXPECT_EQ(batch.readMemory(lane, 0x50 + i), chip8core::Chip8CPU::chip8Font[i]);
+        }
+    }
+}
+
+// Test that lanes running identical code take the uniform path.
+TEST(Chip8BatchTest, UniformArithmetic)
+{
+    std::vector<uint8_t> rom = {
+        0x60, 0xF0, // V0 = 0xF0
+        0x61, 0x20, // V1 = 0x20
+        0x80, 0x14, // V0 += V1, VF = carry
+        0xA3, 0x00, // I = 0x300
+    };
+    chip8core::Chip8Batch batch(8);
+    batch.loadROM(rom.data(), rom.size());
+    for (int i = 0; i < 4; ++i)
+    {
+        batch.step();
+    }
+
+    for (size_t lane = 0; lane < batch.size(); ++lane)
+    {
+        EXPECT_EQ(batch.getV(lane, 0), 0x10);
+        EXPECT_EQ(batch.getV(lane, 0xF), 1);
+        EXPECT_EQ(batch.getI(lane), 0x300);
+        EXPECT_EQ(batch.getPC(lane), 0x208);
+    }
+    EXPECT_EQ(batch.getUniformSteps(), 4u);
+    EXPECT_EQ(batch.getDivergentSteps(), 0u);
+}
+
+// Test that lanes with different input diverge and are executed per lane.
+TEST(Chip8BatchTest, DivergentLanesFallBack)
+{
+    std::vector<uint8_t> rom = {
+        0xE0, 0x9E, // skip next if key V0 (0) is pressed
+        0x62, 0x07, // V2 = 7
+        0x63, 0x01, // V3 = 1
+    };
+    chip8core::Chip8Batch batch(2);
+    batch.loadROM(rom.data(), rom.size());
+    batch.setKeys(0, 0x0001);
+
+    batch.step();
+    EXPECT_EQ(batch.getPC(0), 0x204);
+    EXPECT_EQ(batch.getPC(1), 0x202);
+
+    batch.step();
+    EXPECT_EQ(batch.getV(0, 3), 1);
+    EXPECT_EQ(batch.getV(1, 2), 7);
+    EXPECT_EQ(batch.getV(0, 2), 0);
+    EXPECT_EQ(batch.getDivergentSteps(), 1u);
+}
+
+// Test that sprites are drawn per lane with collision detection and wrapping.
+TEST(Chip8BatchTest, DrawSpriteWrapsAndCollides)
+{
+    std::vector<uint8_t> rom = {
+        0x60, 0x3C, // V0 = 60
+        0x61, 0x1F, // V1 = 31
+        0xA2, 0x0C, // I = 0x20C
+        0xD0, 0x12, // draw 2 rows at (60, 31)
+        0xD0, 0x12, // draw again to erase
+        0x00, 0x00, // padding
+        0xFF, 0x81, // sprite data
+    };
+    chip8core::Chip8Batch batch(3);
+    batch.loadROM(rom.data(), rom.size());
+    for (int i = 0; i < 4; ++i)
+    {
+        batch.step();
+    }
+
+    for (size_t lane = 0; lane < batch.size(); ++lane)
+    {
+        const uint64_t* rows = batch.getFrameBuffer(lane);
+        EXPECT_EQ(rows[31], 0xF00000000000000FULL);
+        EXPECT_EQ(rows[0], 0x1000000000000008ULL);
+        EXPECT_EQ(batch.getV(lane, 0xF), 0);
+    }
+
+    batch.step();
+    for (size_t lane = 0; lane < batch.size(); ++lane)
+    {
+        EXPECT_EQ(batch.getFrameBuffer(lane)[31], 0u);
+        EXPECT_EQ(batch.getV(lane, 0xF), 1);
+    }
+}
+
+// Test that timers count down once per frame.
+TEST(Chip8BatchTest, RunFrameUpdatesTimers)
+{
+    std::vector<uint8_t> rom = {
+        0x60, 0x05, // V0 = 5
+        0xF0, 0x15, // DT = V0
+        0xF0, 0x18, // ST = V0
+        0x12, 0x06, // loop
+    };
+    chip8core::Chip8Batch batch(2);
+    batch.loadROM(rom.data(), rom.size());
+    batch.runFrame(10);
+
+    for (size_t lane = 0; lane < batch.size(); ++lane)
+    {
+        EXPECT_EQ(batch.getDelayTimer(lane), 4);
+        EXPECT_EQ(batch.getSoundTimer(lane), 4);
+    }
+}
@@ -92,6 +92,28 @@ TEST_F(Chip8CPUTest, opcode_2NNN_test)
     EXPECT_EQ(cpu.getPC(), 0x234) << "Program counter should jump to 0x234";
 }
 
+TEST_F(Chip8CPUTest, StackWrapsAtSixteenLevels)
+{
+    memory.write(0x200, 0x22); // CALL 0x200, nesting one level deeper each cycle
+    memory.write(0x201, 0x00);
+
+    for (int call = 1; call <= 17; ++call)
+    {
+        cpu.cycle();
+        EXPECT_EQ(cpu.getSP(), call & 0xF) << "Stack pointer after call " << call;
+    }
+    EXPECT_EQ(cpu.getStack(1), 0x202) << "17th call should overwrite the oldest level";
+
+    memory.write(0x200, 0x00); // RET to 0x202, then RET again from there
+    memory.write(0x201, 0xEE);
+    memory.write(0x202, 0x00);
+    memory.write(0x203, 0xEE);
+    cpu.cycle();
+    EXPECT_EQ(cpu.getSP(), 0);
+    cpu.cycle();
+    EXPECT_EQ(cpu.getSP(), 15) << "Return from level 0 should wrap to 15, not underflow";
+}
+
 TEST_F(Chip8CPUTest, opcode_3XNN_test_Equal)
 {
     memory.write(0x200, 0x34);
@@ -810,6 +832,44 @@ TEST_F(Chip8CPUTest, opcode_FX18_test)
     EXPECT_EQ(cpu.getPC(), 0x202) << "Program counter should be incremented by 2";
 }
 
+TEST_F(Chip8CPUTest, opcode_F002_test)
+{
+    memory.write(0x200, 0xF0);
+    memory.write(0x201, 0x02);
+    for (int i = 0; i < 16; ++i)
+    {
+        memory.write(0x300 + i, static_cast<uint8_t>(i * 17));
+    }
+    cpu.setI(0x300);
+    uint32_t generation = cpu.getAudioGeneration();
+
+    EXPECT_FALSE(cpu.hasAudioPattern());
+    cpu.cycle();
+
+    EXPECT_TRUE(cpu.hasAudioPattern()) << "F002 should load an audio pattern";
+    EXPECT_EQ(cpu.getAudioPattern()[0], 0x00);
+    EXPECT_EQ(cpu.getAudioPattern()[15], 0xFF) << "Pattern should be the 16 bytes at I";
+    EXPECT_NE(cpu.getAudioGeneration(), generation);
+    EXPECT_EQ(cpu.getPC(), 0x202) << "Program counter should be incremented by 2";
+}
+
+TEST_F(Chip8CPUTest, opcode_FX3A_test)
+{
+    memory.write(0x200, 0xF3);
+    memory.write(0x201, 0x3A);
+
+    cpu.setV(3, 0x70);
+    EXPECT_EQ(cpu.getPitch(), chip8core::Chip8CPU::DEFAULT_PITCH);
+
+    cpu.cycle();
+
+    EXPECT_EQ(cpu.getPitch(), 0x70) << "Pitch should be equal to V3";
+    EXPECT_EQ(cpu.getPC(), 0x202) << "Program counter should be incremented by 2";
+
+    cpu.reset();
+    EXPECT_EQ(cpu.getPitch(), chip8core::Chip8CPU::DEFAULT_PITCH) << "Reset restores the pitch";
+}
+
 TEST_F(Chip8CPUTest, opcode_FX1E_test)
 {
     memory.write(0x200, 0xF2);
@@ -944,4 +1004,27 @@ TEST_F(Chip8CPUTest, opcode_FX65_test)
     EXPECT_EQ(cpu.getV(14), 0x77) << "V[14] should be equal to 0x77";
     EXPECT_EQ(cpu.getV(15), 0x88) << "V[15] should be equal to 0x88";
     EXPECT_EQ(cpu.getPC(), 0x202) << "Program counter should be incremented by 2";
-}
\ No newline at end of file
+}
+
+// Test that the state view points at the live registers and stack.
+TEST_F(Chip8CPUTest, StateViewFollowsExecution)
+{
+    const chip8core::Chip8CPUStateView view = cpu.getStateView();
+
+    memory.write(0x200, 0x23); // CALL 0x300
+    memory.write(0x201, 0x00);
+    memory.write(0x300, 0x6A); // LD VA, 0x42
+    memory.write(0x301, 0x42);
+    memory.write(0x302, 0xA1); // LD I, 0x123
+    memory.write(0x303, 0x23);
+    cpu.cycle();
+    cpu.cycle();
+    cpu.cycle();
+
+    EXPECT_EQ(view.v[0xA], 0x42);
+    EXPECT_EQ(*view.i, 0x123);
+    EXPECT_EQ(*view.pc, 0x304);
+    EXPECT_EQ(*view.sp, cpu.getSP());
+    EXPECT_EQ(view.stack[*view.sp], cpu.getStack(cpu.getSP()));
+    EXPECT_EQ(*delayTimer.data(), delayTimer.getValue());
+}
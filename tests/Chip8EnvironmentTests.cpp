@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Chip8Core/Chip8Environment.h"
+
+namespace
+{
+// Writes 1 to 0x301 while key 5 is held and 0 otherwise.
+const std::vector<uint8_t> kKeyRom = {
+    0x60, 0x05, // 0x200: V0 = 5
+    0x61, 0x00, // 0x202: V1 = 0
+    0xE0, 0xA1, // 0x204: skip next if key 5 is not pressed
+    0x61, 0x01, // 0x206: V1 = 1
+    0xA3, 0x00, // 0x208: I = 0x300
+    0xF1, 0x55, // 0x20A: store V0..V1 at 0x300
+    0x12, 0x00, // 0x20C: loop
+};
+} // namespace
+
+// Test that reset produces a blank observation and zero reward.
+TEST(Chip8EnvironmentTest, ResetObservation)
+{
+    chip8core::Chip8Environment env(kKeyRom);
+    const auto&                 obs = env.reset(7);
+    for (uint64_t row : obs.framebuffer)
+    {
+        EXPECT_EQ(row, 0u);
+    }
+    EXPECT_FALSE(obs.soundOn);
+    EXPECT_EQ(obs.reward, 0.0f);
+    EXPECT_EQ(env.getMachine().getCPU().getPC(), 0x200);
+}
+
+// Test that the key mask is applied for each step and the reward probe reads memory.
+TEST(Chip8EnvironmentTest, StepAppliesKeysAndReward)
+{
+    chip8core::Chip8Environment env(kKeyRom);
+    env.setRewardProbe([](const chip8core::Chip8& machine)
+                       { return static_cast<float>(machine.getMemory().read(0x301)); });
+    env.reset(1);
+
+    EXPECT_EQ(env.step(0x0000, 3).reward, 0.0f);
+    EXPECT_EQ(env.step(1 << 5, 2).reward, 1.0f);
+    EXPECT_EQ(env.step(1 << 4).reward, 0.0f);
+
+    env.reset(1);
+    EXPECT_EQ(env.getObservation().reward, 0.0f);
+}
+
+// Test that the same seed reproduces the same CXKK results.
+TEST(Chip8EnvironmentTest, SeedIsReproducible)
+{
+    const std::vector<uint8_t> rom = {
+        0xC0, 0xFF, // V0 = random
+        0x12, 0x02, // halt
+    };
+    chip8core::Chip8Environment first(rom);
+    chip8core::Chip8Environment second(rom);
+    first.reset(1234);
+    second.reset(1234);
+    first.step(0);
+    second.step(0);
+    EXPECT_EQ(first.getMachine().getCPU().getV(0), second.getMachine().getCPU().getV(0));
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "Chip8Core/Chip8Farm.h"
+#include "Chip8Core/Chip8GraphicsBuffer.h"
+
+namespace
+{
+std::vector<uint8_t> readROM(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)),
+                                std::istreambuf_iterator<char>());
+}
+} // namespace
+
+// Test that the framebuffer hash depends on pixel values and their row.
+TEST(Chip8FarmTest, HashRows)
+{
+    uint64_t rows[chip8core::Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT] = {};
+    uint64_t empty = chip8core::Chip8GraphicsBuffer::hashRows(rows);
+    EXPECT_EQ(chip8core::Chip8GraphicsBuffer::hashRows(rows), empty);
+
+    rows[3]       = 0x8000000000000001ull;
+    uint64_t row3 = chip8core::Chip8GraphicsBuffer::hashRows(rows);
+    EXPECT_NE(row3, empty);
+
+    rows[3] = 0;
+    rows[4] = 0x8000000000000001ull;
+    EXPECT_NE(chip8core::Chip8GraphicsBuffer::hashRows(rows), row3);
+}
+
+// Test that input scripts skip comments and accept hex masks.
+TEST(Chip8FarmTest, ReadInputScript)
+{
+    std::istringstream          in("# frame mask\n10 0x0010\n\n14 0 # release\n");
+    chip8core::Chip8InputScript script = chip8core::readInputScript(in);
+    ASSERT_EQ(script.size(), 2u);
+    EXPECT_EQ(script[0].frame, 10);
+    EXPECT_EQ(script[0].keyMask, 0x0010);
+    EXPECT_EQ(script[1].frame, 14);
+    EXPECT_EQ(script[1].keyMask, 0);
+}
+
+// Test that parallel runs are deterministic and round-trip through a golden file.
+TEST(Chip8FarmTest, GoldenRoundTrip)
+{
+    std::vector<chip8core::Chip8FarmJob> jobs;
+    for (const char* name : {"1-chip8-logo.ch8", "2-ibm-logo.ch8", "3-corax+.ch8", "4-flags.ch8"})
+    {
+        jobs.push_back({name, readROM(std::filesystem::path(CHIP8_ROM_DIR) / name), {}});
+        ASSERT_FALSE(jobs.back().rom.empty()) << name;
+    }
+
+    chip8core::Chip8FarmOptions options;
+    options.frames  = 120;
+    options.threads = 3;
+    std::vector<chip8core::Chip8FarmResult> results = chip8core::Chip8Farm(options).run(jobs);
+    ASSERT_EQ(results.size(), jobs.size());
+    EXPECT_EQ(results[0].frames, (std::vector<int>{60, 120}));
+
+    std::stringstream golden;
+    chip8core::Chip8Farm::writeGolden(golden, results);
+    chip8core::Chip8GoldenHashes hashes = chip8core::Chip8Farm::readGolden(golden);
+
+    options.threads = 1;
+    std::vector<chip8core::Chip8FarmResult> rerun = chip8core::Chip8Farm(options).run(jobs);
+    for (const chip8core::Chip8FarmResult& result : rerun)
+    {
+        EXPECT_TRUE(result.error.empty()) << result.error;
+        EXPECT_TRUE(chip8core::Chip8Farm::compare(result, hashes).empty()) << result.name;
+    }
+
+    // A different frame at one checkpoint is reported
+    rerun[1].hashes[1] ^= 1;
+    std::vector<std::string> mismatches = chip8core::Chip8Farm::compare(rerun[1], hashes);
+    ASSERT_EQ(mismatches.size(), 1u);
+    EXPECT_EQ(mismatches[0].rfind("frame 120:", 0), 0u);
+}
+
+// Test that a run stops at an invalid opcode and reports it instead of hashing the frames.
+TEST(Chip8FarmTest, FaultStopsRun)
+{
+    const std::vector<uint8_t> rom = {
+        0x60, 0x01, // V0 = 1
+        0xF0, 0xFF, // Not an opcode
+    };
+    chip8core::Chip8FarmOptions options;
+    options.frames                    = 120;
+    chip8core::Chip8FarmResult result = chip8core::Chip8Farm(options).runJob({"ret.ch8", rom, {}});
+
+    EXPECT_TRUE(result.hashes.empty());
+    EXPECT_EQ(result.error, "faulted in frame 1: invalid opcode F0FF at 202");
+
+    std::stringstream golden;
+    chip8core::Chip8Farm::writeGolden(golden, {result});
+    EXPECT_TRUE(golden.str().empty());
+}
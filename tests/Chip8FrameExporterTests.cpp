@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Chip8Core/Chip8FrameExporter.h"
+#include "Chip8Core/Chip8GraphicsBuffer.h"
+
+// Test that a single frame is expanded to one byte per pixel.
+TEST(Chip8FrameExporterTest, BytesLayout)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    graphics.setPixel(0, 0, true);
+    graphics.setPixel(63, 31, true);
+    graphics.setPixel(9, 2, true);
+
+    chip8core::Chip8FrameExporter exporter(2);
+    exporter.capture(1, graphics.data());
+    std::vector<uint8_t> out(exporter.getOutputSize(), 0xAA);
+    ASSERT_EQ(out.size(), 2u * 32 * 64);
+    exporter.exportTo(out.data());
+
+    // Machine 0 never captured a frame
+    for (size_t i = 0; i < 32 * 64; ++i)
+    {
+        EXPECT_EQ(out[i], 0);
+    }
+    const uint8_t* frame = &out[32 * 64];
+    for (int y = 0; y < 32; ++y)
+    {
+        for (int x = 0; x < 64; ++x)
+        {
+            EXPECT_EQ(frame[y * 64 + x], graphics.getPixel(x, y) ? 255 : 0)
+                << "Pixel at (" << x << ", " << y << ")";
+        }
+    }
+}
+
+// Test that bit-packed frames keep the leftmost pixel in the most significant bit.
+TEST(Chip8FrameExporterTest, BitPackedLayout)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    graphics.setPixel(0, 1, true);
+    graphics.setPixel(15, 1, true);
+
+    chip8core::Chip8FrameExportOptions options;
+    options.format = chip8core::Chip8FrameFormat::BitPacked;
+    chip8core::Chip8FrameExporter exporter(1, options);
+    exporter.capture(0, graphics.data());
+    std::vector<uint8_t> out(exporter.getOutputSize());
+    ASSERT_EQ(out.size(), 32u * 8);
+    exporter.exportTo(out.data());
+
+    EXPECT_EQ(out[8 + 0], 0x80);
+    EXPECT_EQ(out[8 + 1], 0x01);
+    EXPECT_EQ(out[0], 0x00);
+}
+
+// Test that stacked frames are written oldest first and max-pooling ORs adjacent frames.
+TEST(Chip8FrameExporterTest, StackingAndMaxPool)
+{
+    chip8core::Chip8GraphicsBuffer first;
+    chip8core::Chip8GraphicsBuffer second;
+    chip8core::Chip8GraphicsBuffer third;
+    first.setPixel(0, 0, true);
+    second.setPixel(1, 0, true);
+    third.setPixel(2, 0, true);
+
+    chip8core::Chip8FrameExportOptions options;
+    options.format  = chip8core::Chip8FrameFormat::BitPacked;
+    options.stack   = 2;
+    options.maxPool = true;
+    chip8core::Chip8FrameExporter exporter(1, options);
+    exporter.capture(0, first.data());
+    exporter.capture(0, second.data());
+    exporter.capture(0, third.data());
+
+    std::vector<uint8_t> out(exporter.getOutputSize());
+    ASSERT_EQ(out.size(), 2u * 32 * 8);
+    exporter.exportTo(out.data());
+
+    EXPECT_EQ(out[0], 0xC0) << "Older slot should pool the first and second frames";
+    EXPECT_EQ(out[32 * 8], 0x60) << "Newest slot should pool the second and third frames";
+}
+
+TEST(Chip8FrameExporterTest, DetectsRepeatedFrames)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    chip8core::Chip8FrameExporter  exporter(1);
+    exporter.capture(0, graphics);
+    EXPECT_TRUE(exporter.isRepeat(0)) << "A blank first frame repeats the blank history";
+
+    graphics.setPixel(4, 4, true);
+    exporter.capture(0, graphics);
+    EXPECT_FALSE(exporter.isRepeat(0));
+    EXPECT_EQ(exporter.getFrameHash(0), graphics.getHash());
+
+    // Packed rows hash the same as the maintained hash
+    exporter.capture(0, graphics.data());
+    EXPECT_TRUE(exporter.isRepeat(0));
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8FramePacer.h"
+
+// Test that a second of 60Hz frames runs exactly one second of CPU cycles.
+TEST(Chip8FramePacerTest, CarriesCycleFractions)
+{
+    chip8core::Chip8FramePacer pacer(60.0);
+    chip8core::Chip8Stats      stats;
+
+    uint64_t cycles = 0;
+    uint64_t now    = 1000000000;
+    for (int frame = 0; frame < 60; ++frame)
+    {
+        uint64_t run = pacer.beginFrame(now, stats);
+        EXPECT_TRUE(run == 11 || run == 12) << "Frame " << frame << " ran " << run;
+        cycles += run;
+        now = pacer.getDeadline();
+    }
+    EXPECT_NEAR(static_cast<double>(cycles), chip8core::Chip8::CPU_HZ, 1);
+    EXPECT_EQ(stats.cyclesDropped, 0u);
+}
+
+// Test that a stall catches up at most MAX_CATCH_UP_FRAMES and reports the rest as dropped.
+TEST(Chip8FramePacerTest, CapsCatchUpAfterStall)
+{
+    chip8core::Chip8FramePacer pacer(60.0);
+    chip8core::Chip8Stats      stats;
+
+    uint64_t now = 1000000000;
+    pacer.beginFrame(now, stats);
+    uint64_t run = pacer.beginFrame(now + 1000000000, stats); // A one second stall
+
+    EXPECT_LE(run, 2u * 12);
+    EXPECT_EQ(pacer.getDroppedFrames(), 60u - chip8core::Chip8FramePacer::MAX_CATCH_UP_FRAMES);
+    EXPECT_NEAR(static_cast<double>(stats.cyclesDropped), 58 * 700 / 60.0, 1);
+    EXPECT_GT(pacer.getDeadline(), now + 1000000000);
+}
+
+// Test that deadlines move onto the vsync grid, LEAD_NS ahead of each vsync.
+TEST(Chip8FramePacerTest, AlignsDeadlinesToVsync)
+{
+    chip8core::Chip8FramePacer pacer(60.0);
+    chip8core::Chip8Stats      stats;
+    const uint64_t             period = pacer.getPeriodNs();
+
+    uint64_t now = 1000000000;
+    pacer.beginFrame(now, stats);
+    pacer.onVsync(now + period / 3);
+    pacer.beginFrame(pacer.getDeadline(), stats);
+
+    uint64_t grid = now + period / 3 - chip8core::Chip8FramePacer::LEAD_NS;
+    EXPECT_EQ((pacer.getDeadline() - grid) % period, 0u);
+}
+
+// Test that vsync timestamps of a 144Hz display run one emulated second per second.
+TEST(Chip8FramePacerTest, TimestampsFollowRefreshRate)
+{
+    chip8core::Chip8FramePacer pacer;
+    chip8core::Chip8Stats      stats;
+
+    uint64_t cycles = 0;
+    for (int frame = 0; frame <= 144; ++frame)
+    {
+        uint64_t run = pacer.beginFrameAt(5000000000 + frame * 1000000000ull / 144, stats);
+        EXPECT_LE(run, 5u) << "Frame " << frame << " ran " << run;
+        cycles += run;
+    }
+    EXPECT_NEAR(static_cast<double>(cycles), chip8core::Chip8::CPU_HZ, 1);
+    EXPECT_NEAR(static_cast<double>(pacer.getPeriodNs()), 1e9 / 144, 1);
+    EXPECT_EQ(stats.cyclesDropped, 0u);
+}
+
+// Test that a paused clock owes nothing for the time away, while a stall is capped and dropped.
+TEST(Chip8FramePacerTest, TimestampPauseOwesNothing)
+{
+    chip8core::Chip8FramePacer pacer;
+    chip8core::Chip8Stats      stats;
+    const uint64_t             period = pacer.getPeriodNs();
+
+    uint64_t now = 1000000000;
+    EXPECT_EQ(pacer.beginFrameAt(now, stats), 0u);
+    EXPECT_GE(pacer.beginFrameAt(now += period, stats), 11u);
+
+    pacer.pause();
+    EXPECT_TRUE(pacer.isPaused());
+    EXPECT_EQ(pacer.beginFrameAt(now += 10000000000, stats), 0u); // Back after ten seconds
+    EXPECT_LE(pacer.beginFrameAt(now += period, stats), 12u);
+    EXPECT_EQ(stats.cyclesDropped, 0u);
+
+    uint64_t run = pacer.beginFrameAt(now += 1000000000, stats); // A one second stall
+    EXPECT_LE(run, 2u * 12);
+    EXPECT_NEAR(static_cast<double>(stats.cyclesDropped), 58 * 700 / 60.0, 1);
+}
+
+// Test that sleepUntil() never wakes early, and wakes at the deadline rather than a timer slice
+// later. The best of a few sleeps is checked, so a preempted test runner does not fail it.
+TEST(Chip8FramePacerTest, SleepsPrecisely)
+{
+    uint64_t best = UINT64_MAX;
+    for (int attempt = 0; attempt < 5; ++attempt)
+    {
+        uint64_t deadline = chip8core::Chip8Stats::now() + 5000000;
+        chip8core::Chip8FramePacer::sleepUntil(deadline);
+        uint64_t woke = chip8core::Chip8Stats::now();
+        ASSERT_GE(woke, deadline);
+        best = std::min(best, woke - deadline);
+    }
+    EXPECT_LT(best, 5000000u);
+}
+
+// Test that a slow host frame owes the machine at most MAX_CATCH_UP_FRAMES of cycles.
+TEST(Chip8FramePacerTest, CycleCatchUpIsBudgeted)
+{
+    const uint8_t              loop[] = {0x12, 0x00}; // JP 0x200
+    chip8core::Chip8           machine;
+    chip8core::Chip8FramePacer pacer(60.0);
+    machine.loadROM(loop, sizeof(loop));
+
+    uint64_t now = 1000000000;
+    machine.cycleUntil(machine.getEmulatedClock() + pacer.beginFrame(now, machine.getStats()));
+    uint64_t before = machine.getCycleCount();
+
+    now += 100000000; // A 100ms host frame, 70 cycles late
+    uint64_t owed = pacer.beginFrame(now, machine.getStats());
+    machine.cycleUntil(machine.getEmulatedClock() + owed);
+
+    EXPECT_LE(owed, chip8core::Chip8FramePacer::MAX_CATCH_UP_FRAMES * 12u);
+    EXPECT_EQ(machine.getCycleCount() - before, owed);
+    EXPECT_NEAR(static_cast<double>(machine.getStats().cyclesDropped), 70 - owed, 12);
+}
+
+// Test that cycle() spreads wall-clock catch-up over several calls. sleep_for() may oversleep
+// by any amount, so only bounds that hold for a longer sleep are checked.
+TEST(Chip8FramePacerTest, WallClockCatchUpIsBudgeted)
+{
+    chip8core::Chip8 machine;
+    machine.cycle();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100)); // At least 70 cycles owed
+
+    EXPECT_EQ(machine.cycle(), chip8core::Chip8::CATCH_UP_BUDGET);
+    EXPECT_GE(machine.cycle(), 70 - chip8core::Chip8::CATCH_UP_BUDGET - 1); // The rest
+}
+
+// Test that frame-by-frame cycleUntil() keeps CPU and clock exact at rates not dividing 700Hz.
+TEST(Chip8FramePacerTest, CycleUntilCarriesPartialCycles)
+{
+    const uint8_t loop[] = {0x12, 0x00}; // JP 0x200
+    for (int cyclesPerFrame : {1, 10, 12, 20})
+    {
+        chip8core::Chip8 machine;
+        machine.loadROM(loop, sizeof(loop));
+        machine.setCyclesPerFrame(cyclesPerFrame);
+
+        chip8core::Chip8FramePacer pacer(60.0);
+        uint64_t                   now = 1000000000;
+        for (int frame = 0; frame < 600; ++frame) // Ten seconds
+        {
+            uint64_t owed = pacer.beginFrame(now, machine.getStats());
+            machine.cycleUntil(machine.getEmulatedClock() + owed);
+            now = pacer.getDeadline();
+        }
+        double oneClock = cyclesPerFrame * 60.0 / chip8core::Chip8::CPU_HZ; // The pacer's rounding
+        EXPECT_NEAR(static_cast<double>(machine.getCycleCount()), cyclesPerFrame * 600,
+                    oneClock + 1)
+            << cyclesPerFrame << " cycles per frame";
+        EXPECT_NEAR(static_cast<double>(machine.getEmulatedClock()), 7000, 1)
+            << cyclesPerFrame << " cycles per frame";
+    }
+}
@@ -40,3 +40,59 @@ TEST(Chip8GraphicsBufferTests, OutOfBoundsGetPixel)
     EXPECT_THROW(graphics.getPixel(0, chip8core::Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT),
                  chip8core::Chip8GraphicsError);
 }
+
+TEST(Chip8GraphicsBufferTests, PackedRowLayout)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    graphics.setPixel(0, 3, true);
+    graphics.setPixel(63, 3, true);
+    EXPECT_EQ(graphics.getRow(3), 0x8000000000000001ULL);
+    EXPECT_EQ(graphics.data()[3], graphics.getRow(3));
+}
+
+TEST(Chip8GraphicsBufferTests, DrawSpriteRowWrapsAndCollides)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    EXPECT_FALSE(graphics.drawSpriteRow(60, 33, 0b11111111));
+    EXPECT_TRUE(graphics.getPixel(60, 1));
+    EXPECT_TRUE(graphics.getPixel(63, 1));
+    EXPECT_TRUE(graphics.getPixel(0, 1));
+    EXPECT_TRUE(graphics.getPixel(3, 1));
+    EXPECT_FALSE(graphics.getPixel(4, 1));
+
+    EXPECT_TRUE(graphics.drawSpriteRow(60, 1, 0b10000000));
+    EXPECT_FALSE(graphics.getPixel(60, 1));
+}
+
+TEST(Chip8GraphicsBufferTests, DumpFrameBufferMatchesPixels)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    graphics.setPixel(5, 7, true);
+    std::vector<uint32_t> pixels = graphics.dumpFrameBuffer();
+    ASSERT_EQ(pixels.size(), 64u * 32u);
+    EXPECT_EQ(pixels[7 * 64 + 5], 0xFFFFFFFF);
+    EXPECT_EQ(pixels[7 * 64 + 6], 0x00000000);
+}
+
+TEST(Chip8GraphicsBufferTests, IncrementalHashMatchesRows)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    uint64_t                       empty = graphics.getHash();
+    EXPECT_EQ(empty, chip8core::Chip8GraphicsBuffer::hashRows(graphics.data()));
+
+    graphics.drawSpriteRow(60, 33, 0b10110111);
+    graphics.setPixel(5, 7, true);
+    graphics.setPixel(5, 7, true);
+    graphics.drawSpriteRow(2, 7, 0);
+    EXPECT_EQ(graphics.getHash(), chip8core::Chip8GraphicsBuffer::hashRows(graphics.data()));
+    EXPECT_FALSE(graphics.isSameFrame(empty));
+
+    // Undoing every write brings back the empty frame's hash
+    graphics.drawSpriteRow(60, 1, 0b10110111);
+    graphics.setPixel(5, 7, false);
+    EXPECT_TRUE(graphics.isSameFrame(empty));
+
+    graphics.setPixel(0, 0, true);
+    graphics.clear();
+    EXPECT_TRUE(graphics.isSameFrame(empty));
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8InputQueue.h"
+
+namespace
+{
+// FX0A V5 in a loop: 0x200 LD V5, K; 0x202 JP 0x202
+const uint8_t WAIT_FOR_KEY[] = {0xF5, 0x0A, 0x12, 0x02};
+
+class KeyLog : public chip8core::Chip8InputObserver
+{
+  public:
+    void onKeysChanged(uint64_t cycle, uint16_t keyMask) override
+    {
+        cycles.push_back(cycle);
+        masks.push_back(keyMask);
+    }
+
+    std::vector<uint64_t> cycles;
+    std::vector<uint16_t> masks;
+};
+} // namespace
+
+// Test that events come out in order and a full queue rejects pushes.
+TEST(Chip8InputQueueTest, FifoAndCapacity)
+{
+    chip8core::Chip8InputQueue queue;
+    chip8core::Chip8KeyEvent   event;
+    EXPECT_FALSE(queue.peek(event));
+
+    for (size_t i = 0; i < chip8core::Chip8InputQueue::CAPACITY; ++i)
+    {
+        EXPECT_TRUE(queue.push({i, static_cast<uint8_t>(i & 0xF), true}));
+    }
+    EXPECT_FALSE(queue.push({0, 0, false}));
+    EXPECT_EQ(queue.size(), chip8core::Chip8InputQueue::CAPACITY);
+
+    for (size_t i = 0; i < chip8core::Chip8InputQueue::CAPACITY; ++i)
+    {
+        ASSERT_TRUE(queue.peek(event));
+        EXPECT_EQ(event.timestampNs, i);
+        queue.pop();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+// Test that a producer thread and a consumer thread see every event once, in order.
+TEST(Chip8InputQueueTest, ProducerConsumerThreads)
+{
+    constexpr uint64_t         EVENTS = 20000;
+    chip8core::Chip8InputQueue queue;
+
+    std::thread producer(
+        [&queue]()
+        {
+            for (uint64_t i = 0; i < EVENTS;)
+            {
+                if (queue.push({i, static_cast<uint8_t>(i & 0xF), (i & 1) != 0}))
+                    ++i;
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+    uint64_t expected = 0;
+    while (expected < EVENTS)
+    {
+        chip8core::Chip8KeyEvent event;
+        if (queue.peek(event))
+        {
+            ASSERT_EQ(event.timestampNs, expected);
+            ASSERT_EQ(event.key, expected & 0xF);
+            queue.pop();
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(queue.empty());
+}
+
+// Test that a tap shorter than one host frame reaches FX0A at the cycles matching its timestamps.
+TEST(Chip8InputQueueTest, AppliesEventsAtMatchingCycles)
+{
+    chip8core::Chip8 chip8;
+    chip8.setSeed(1);
+    chip8.reset();
+    chip8.loadROM(WAIT_FOR_KEY, sizeof(WAIT_FOR_KEY));
+
+    chip8core::Chip8InputQueue queue;
+    KeyLog                     log;
+    chip8.attachInputQueue(&queue);
+    chip8.setInputObserver(&log);
+
+    // One 12-cycle host frame ending at 1s; key 7 is tapped for about three cycles
+    const uint64_t endNs   = 1000000000;
+    const uint64_t cycleNs = 1000000000 / 700;
+    queue.push({endNs - 8 * cycleNs, 7, true});
+    queue.push({endNs - 5 * cycleNs, 7, false});
+    queue.push({endNs + cycleNs, 3, true}); // Still in the future
+    chip8.runCycles(12, endNs);
+
+    EXPECT_EQ(chip8.getCycleCount(), 12u);
+    EXPECT_EQ(chip8.getCPU().getV(5), 7);
+    EXPECT_EQ(chip8.getCPU().getPC(), 0x202);
+    ASSERT_EQ(log.cycles.size(), 2u);
+    EXPECT_EQ(log.cycles[0], 4u);
+    EXPECT_EQ(log.masks[0], 1 << 7);
+    EXPECT_EQ(log.cycles[1], 7u);
+    EXPECT_EQ(log.masks[1], 0);
+    EXPECT_EQ(queue.size(), 1u);
+}
+
+// Test that a press and release sharing a timestamp still leave one cycle between them.
+TEST(Chip8InputQueueTest, SimultaneousEventsGetACycleEach)
+{
+    chip8core::Chip8 chip8;
+    chip8.reset();
+    chip8.loadROM(WAIT_FOR_KEY, sizeof(WAIT_FOR_KEY));
+
+    chip8core::Chip8InputQueue queue;
+    chip8.attachInputQueue(&queue);
+    const uint64_t endNs = 1000000000;
+    const uint64_t tapNs = endNs - 3 * (endNs / 700);
+    queue.push({tapNs, 0xA, true});
+    queue.push({tapNs, 0xA, false});
+    chip8.runCycles(4, endNs);
+
+    EXPECT_EQ(chip8.getCPU().getV(5), 0xA);
+    EXPECT_TRUE(queue.empty());
+}
+
+// Test that released keys are derived from the previous and current masks.
+TEST(Chip8InputQueueTest, ReleasedKeysFromMask)
+{
+    chip8core::Chip8InputBuffer input;
+    input.setKeyMask(0x0012);
+    input.syncKeyStates();
+    input.setKeyState(4, false);
+    input.setKeyState(9, true);
+    EXPECT_EQ(input.getKeyMask(), 0x0202);
+    EXPECT_EQ(input.getReleasedKeys(), 0x0010);
+    EXPECT_TRUE(input.wasKeyReleased(4));
+    EXPECT_FALSE(input.wasKeyReleased(1));
+
+    input.syncKeyStates();
+    EXPECT_EQ(input.getReleasedKeys(), 0);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "Chip8Core/Chip8Disassembler.h"
+#include "Chip8Core/Chip8Lockstep.h"
+
+namespace
+{
+std::vector<uint8_t> readROM(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)),
+                                std::istreambuf_iterator<char>());
+}
+
+// A reference engine seeded differently, so CXKK results disagree
+class MisseededEngine : public chip8core::Chip8ReferenceEngine
+{
+  public:
+    const char* getName() const override { return "misseeded"; }
+    void        reset(const std::vector<uint8_t>& rom, uint32_t seed) override
+    {
+        chip8core::Chip8ReferenceEngine::reset(rom, seed + 1);
+    }
+};
+} // namespace
+
+// Test that opcodes disassemble to the Cowgod mnemonics.
+TEST(Chip8LockstepTest, Disassemble)
+{
+    using chip8core::Chip8Disassembler;
+    EXPECT_EQ(Chip8Disassembler::disassemble(0x00E0), "CLS");
+    EXPECT_EQ(Chip8Disassembler::disassemble(0x2ABC), "CALL 0xABC");
+    EXPECT_EQ(Chip8Disassembler::disassemble(0x8125), "SUB V1, V2");
+    EXPECT_EQ(Chip8Disassembler::disassemble(0xD01F), "DRW V0, V1, 15");
+    EXPECT_EQ(Chip8Disassembler::disassemble(0xF265), "LD V2, [I]");
+    EXPECT_EQ(Chip8Disassembler::disassemble(0xF0FF), "DW 0xF0FF");
+
+    const uint8_t memory[chip8core::Chip8Memory::MEMORY_SIZE] = {0x60, 0x05};
+    EXPECT_EQ(Chip8Disassembler::disassembleAt(memory, 0), "0x000: 6005  LD V0, 0x05");
+}
+
+// Test that the first divergence is reported with the instruction that caused it.
+TEST(Chip8LockstepTest, ReportsFirstDivergence)
+{
+    const std::vector<uint8_t> rom = {0x60, 0x01,  // LD V0, 0x01
+                                      0xC1, 0xFF,  // RND V1, 0xFF
+                                      0x12, 0x04}; // JP 0x204
+
+    chip8core::Chip8ReferenceEngine reference;
+    MisseededEngine                 candidate;
+    chip8core::Chip8Lockstep        lockstep(reference, candidate);
+    chip8core::Chip8Divergence      divergence = lockstep.run(rom, {});
+
+    ASSERT_TRUE(divergence.found);
+    EXPECT_EQ(divergence.field, "V1");
+    EXPECT_EQ(divergence.instructions, 2u);
+    EXPECT_NE(divergence.report.find("0x202: C1FF  RND V1, 0xFF"), std::string::npos);
+    EXPECT_NE(divergence.report.find("misseeded diverged from reference"), std::string::npos);
+}
+
+// Run every bundled ROM on the reference interpreter and a four-lane Chip8Batch with
+// scripted key taps, comparing full state after every instruction.
+TEST(Chip8LockstepTest, BatchMatchesReferenceOnBundledROMs)
+{
+    chip8core::Chip8LockstepOptions options;
+    options.frames = 900;
+    options.input  = chip8core::Chip8Lockstep::tapEveryKey(options.frames);
+
+    int roms = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(CHIP8_ROM_DIR))
+    {
+        if (entry.path().extension() != ".ch8")
+        {
+            continue;
+        }
+        chip8core::Chip8ReferenceEngine reference;
+        chip8core::Chip8BatchEngine     batch(4);
+        chip8core::Chip8Lockstep        lockstep(reference, batch);
+        chip8core::Chip8Divergence divergence = lockstep.run(readROM(entry.path()), options);
+        EXPECT_FALSE(divergence.found) << entry.path().filename() << "\n" << divergence.report;
+        ++roms;
+    }
+    EXPECT_GT(roms, 0);
+}
+
+// Test that the XO-CHIP audio registers are run by Chip8Batch and compared by the harness.
+TEST(Chip8LockstepTest, BatchMatchesReferenceOnAudioOpcodes)
+{
+    std::vector<uint8_t> rom = {0xA2, 0x0A,  // LD I, 0x20A
+                                0xF0, 0x02,  // AUDIO
+                                0x60, 0x70,  // LD V0, 0x70
+                                0xF0, 0x3A,  // PITCH V0
+                                0x12, 0x08}; // JP 0x208
+    for (int i = 0; i < 16; ++i)
+    {
+        rom.push_back(static_cast<uint8_t>(0x11 * i)); // The pattern at 0x20A
+    }
+
+    chip8core::Chip8ReferenceEngine reference;
+    chip8core::Chip8BatchEngine     batch(4);
+    chip8core::Chip8Lockstep        lockstep(reference, batch);
+    chip8core::Chip8LockstepOptions options;
+    options.frames                        = 2;
+    chip8core::Chip8Divergence divergence = lockstep.run(rom, options);
+    EXPECT_FALSE(divergence.found) << divergence.report;
+
+    chip8core::Chip8MachineState state;
+    batch.capture(state);
+    EXPECT_EQ(state.pitch, 0x70);
+    EXPECT_TRUE(state.hasAudioPattern);
+    EXPECT_EQ(state.audioPattern[15], 0xFF);
+
+    chip8core::Chip8MachineState other = state;
+    other.pitch                        = 0x40;
+    EXPECT_EQ(chip8core::Chip8Lockstep::compare(state, other), "pitch");
+    other                 = state;
+    other.audioPattern[3] = 0;
+    EXPECT_EQ(chip8core::Chip8Lockstep::compare(state, other), "audioPattern[3]");
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "Chip8Core/Chip8Movie.h"
+
+namespace
+{
+std::vector<uint8_t> readROM(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)),
+                                std::istreambuf_iterator<char>());
+}
+} // namespace
+
+// Test that movies survive a write and read unchanged.
+TEST(Chip8MovieTest, RoundTrip)
+{
+    chip8core::Chip8Movie movie;
+    movie.seed   = 0xDEADBEEF;
+    movie.cpuHz  = 1200;
+    movie.length = 100000;
+    movie.events = {{0, 0x0010}, {127, 0}, {128, 0x8001}, {99999, 0}};
+
+    std::stringstream file;
+    movie.write(file);
+    EXPECT_LT(file.str().size(), 32u);
+
+    chip8core::Chip8Movie read = chip8core::Chip8Movie::read(file);
+    EXPECT_EQ(read.seed, movie.seed);
+    EXPECT_EQ(read.cpuHz, movie.cpuHz);
+    EXPECT_EQ(read.length, movie.length);
+    ASSERT_EQ(read.events.size(), movie.events.size());
+    for (size_t i = 0; i < movie.events.size(); ++i)
+    {
+        EXPECT_EQ(read.events[i].cycle, movie.events[i].cycle);
+        EXPECT_EQ(read.events[i].keyMask, movie.events[i].keyMask);
+    }
+}
+
+// Test that malformed files are rejected.
+TEST(Chip8MovieTest, RejectsMalformedFiles)
+{
+    std::stringstream notMovie("C8XX");
+    EXPECT_THROW(chip8core::Chip8Movie::read(notMovie), chip8core::Chip8MovieError);
+
+    std::stringstream file;
+    chip8core::Chip8Movie{1, chip8core::Chip8::CPU_HZ, 10, {{5, 1}}}.write(file);
+    std::stringstream truncated(file.str().substr(0, file.str().size() - 1));
+    EXPECT_THROW(chip8core::Chip8Movie::read(truncated), chip8core::Chip8MovieError);
+}
+
+// Test that playback at full speed reproduces a session recorded in uneven host chunks.
+TEST(Chip8MovieTest, PlaybackMatchesRecording)
+{
+    std::vector<uint8_t> rom = readROM(std::filesystem::path(CHIP8_ROM_DIR) / "invaders.ch8");
+    ASSERT_FALSE(rom.empty());
+
+    chip8core::Chip8 live;
+    live.setSeed(42);
+    live.reset();
+    live.loadROM(rom.data(), rom.size());
+    chip8core::Chip8MovieRecorder recorder(live);
+
+    // Press fire and move around, with host frames of varying length
+    const uint16_t keys[] = {0, 1 << 5, 1 << 4, 0, 1 << 6, 1 << 6 | 1 << 5, 0};
+    for (int frame = 0; frame < 900; ++frame)
+    {
+        live.getInput().setKeyMask(keys[(frame / 37) % 7]);
+        recorder.poll(live);
+        live.runCycles(5 + frame % 17);
+    }
+    const chip8core::Chip8Movie& movie = recorder.finish(live);
+    EXPECT_EQ(movie.seed, 42u);
+    EXPECT_GT(movie.events.size(), 10u);
+
+    chip8core::Chip8            replay;
+    chip8core::Chip8MoviePlayer player(movie);
+    player.start(replay, rom.data(), rom.size());
+    player.playToEnd(replay);
+
+    EXPECT_TRUE(player.isFinished(replay));
+    EXPECT_EQ(replay.getCycleCount(), live.getCycleCount());
+    EXPECT_EQ(replay.getGraphics().getHash(), live.getGraphics().getHash());
+    EXPECT_EQ(replay.getCPU().getPC(), live.getCPU().getPC());
+    EXPECT_EQ(replay.getDelayTimer().getValue(), live.getDelayTimer().getValue());
+    for (size_t i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(replay.getCPU().getV(i), live.getCPU().getV(i)) << "V" << i;
+    }
+}
+
+// Test that a session recorded at a non-default CPU rate replays with the same timer ticks.
+TEST(Chip8MovieTest, PlaybackKeepsCpuRate)
+{
+    // Polls the delay timer: V1 counts the ticks seen, V2 is set when a key is down
+    const uint8_t rom[] = {
+        0x60, 0x3C, // 200: V0 = 60
+        0xF0, 0x15, // 202: DT = V0
+        0x65, 0x05, // 204: V5 = 5
+        0xF0, 0x07, // 206: V0 = DT
+        0x30, 0x00, // 208: SE V0, 0
+        0x71, 0x01, // 20A: V1 += 1
+        0xE5, 0xA1, // 20C: SKNP V5
+        0x62, 0x01, // 20E: V2 = 1
+        0x12, 0x06, // 210: JP 206
+    };
+
+    chip8core::Chip8 live;
+    live.setCyclesPerFrame(20);
+    live.reset();
+    live.loadROM(rom, sizeof(rom));
+    chip8core::Chip8MovieRecorder recorder(live);
+    live.runCycles(300);
+    live.getInput().setKeyMask(1 << 5);
+    recorder.poll(live);
+    live.runCycles(300);
+    const chip8core::Chip8Movie& movie = recorder.finish(live);
+    EXPECT_EQ(movie.cpuHz, 1200u);
+
+    std::stringstream file;
+    movie.write(file);
+    chip8core::Chip8Movie       read = chip8core::Chip8Movie::read(file);
+    chip8core::Chip8            replay; // Left at the default rate; the movie sets its own
+    chip8core::Chip8MoviePlayer player(read);
+    player.start(replay, rom, sizeof(rom));
+    player.playToEnd(replay);
+
+    EXPECT_EQ(replay.getCpuHz(), 1200);
+    EXPECT_EQ(replay.getDelayTimer().getValue(), live.getDelayTimer().getValue());
+    EXPECT_EQ(replay.getCPU().getV(1), live.getCPU().getV(1));
+    EXPECT_EQ(replay.getCPU().getV(2), 1);
+}
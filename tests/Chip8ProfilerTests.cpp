@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8Profiler.h"
+
+// Test that opcodes are classified the same way Chip8CPU dispatches them.
+TEST(Chip8ProfilerTest, ClassifyMatchesDispatch)
+{
+    using chip8core::Chip8Profiler;
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0x00E0)), "00E0");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0x00EE)), "00EE");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0x1234)), "1NNN");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0x7A01)), "7XKK");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0x8AB4)), "8XY4");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0x8ABE)), "8XYE");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0xD125)), "DXYN");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0xE3A1)), "EXA1");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0xF265)), "FX65");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0xF002)), "F002");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0xF43A)), "FX3A");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0xF0F0)), "invalid");
+    EXPECT_STREQ(Chip8Profiler::className(Chip8Profiler::classify(0x8AB9)), "invalid");
+}
+
+// Test that counts, hot addresses and reports reflect recorded instructions.
+TEST(Chip8ProfilerTest, RecordAndDump)
+{
+    chip8core::Chip8Profiler profiler(1);
+    for (int i = 0; i < 3; ++i)
+    {
+        profiler.record(0x204, 0x7001);
+    }
+    profiler.record(0x200, 0xD015);
+    profiler.recordSample(0xD015, 40);
+
+    EXPECT_EQ(profiler.getInstructionCount(), 4u);
+    EXPECT_EQ(profiler.getClassCount(chip8core::Chip8Profiler::classify(0x7001)), 3u);
+    EXPECT_EQ(profiler.getPCCount(0x204), 3u);
+    EXPECT_EQ(profiler.getSampledTime(chip8core::Chip8Profiler::classify(0xD015)), 40u);
+
+    std::vector<uint16_t> hot = profiler.getHotPCs(8);
+    ASSERT_EQ(hot.size(), 2u);
+    EXPECT_EQ(hot[0], 0x204);
+    EXPECT_EQ(hot[1], 0x200);
+
+    std::ostringstream json;
+    profiler.dumpJSON(json);
+    EXPECT_NE(json.str().find("{\"name\":\"7XKK\",\"count\":3"), std::string::npos);
+    EXPECT_NE(json.str().find("{\"pc\":516,\"count\":3}"), std::string::npos);
+
+    std::ostringstream text;
+    profiler.dumpText(text);
+    EXPECT_NE(text.str().find("DXYN"), std::string::npos);
+
+    profiler.reset();
+    EXPECT_EQ(profiler.getInstructionCount(), 0u);
+    EXPECT_TRUE(profiler.getHotPCs(8).empty());
+}
+
+#ifdef CHIP8_PROFILING
+// Test that the CPU records every executed instruction when profiling is compiled in.
+TEST(Chip8ProfilerTest, CPUHookCountsInstructions)
+{
+    const uint8_t rom[] = {
+        0x60, 0x01, // V0 = 1
+        0x70, 0x01, // V0 += 1
+        0x12, 0x02, // JP 0x202
+    };
+    chip8core::Chip8 chip8;
+    chip8.loadROM(rom, sizeof(rom));
+    chip8.getProfiler().reset();
+    chip8.runFrame(9);
+
+    const chip8core::Chip8Profiler& profiler = chip8.getProfiler();
+    EXPECT_EQ(profiler.getInstructionCount(), 9u);
+    EXPECT_EQ(profiler.getPCCount(0x200), 1u);
+    EXPECT_EQ(profiler.getPCCount(0x202), 4u);
+    EXPECT_EQ(profiler.getPCCount(0x204), 4u);
+}
+
+// Test that the XO-CHIP audio opcodes are counted in their own classes, not as invalid.
+TEST(Chip8ProfilerTest, CPUHookCountsAudioOpcodes)
+{
+    const uint8_t rom[] = {
+        0xF0, 0x02, // AUDIO
+        0xF0, 0x3A, // PITCH V0
+        0x12, 0x00, // JP 0x200
+    };
+    chip8core::Chip8 chip8;
+    chip8.loadROM(rom, sizeof(rom));
+    chip8.getProfiler().reset();
+    chip8.runFrame(6);
+
+    const chip8core::Chip8Profiler& profiler = chip8.getProfiler();
+    EXPECT_EQ(profiler.getClassCount(chip8core::Chip8Profiler::classify(0xF002)), 2u);
+    EXPECT_EQ(profiler.getClassCount(chip8core::Chip8Profiler::classify(0xF03A)), 2u);
+    EXPECT_EQ(profiler.getClassCount(chip8core::Chip8Profiler::CLASS_COUNT - 1), 0u);
+}
+#endif
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Chip8Core/Chip8Runner.h"
+
+namespace
+{
+// Draws the font glyph for V0, sets the sound timer, then spins on a jump to itself.
+const std::vector<uint8_t> kGlyphRom = {
+    0xC0, 0x0F, // V0 = random & 0xF
+    0xF0, 0x29, // I = glyph V0
+    0x61, 0x00, // V1 = 0
+    0xD1, 0x15, // draw glyph at (0, 0)
+    0x62, 0x10, // V2 = 16
+    0xF2, 0x18, // ST = V2
+    0x12, 0x0C, // halt
+};
+} // namespace
+
+// Test that every machine runs and reports its framebuffer, sound and halt state.
+TEST(Chip8RunnerTest, RunsAllMachines)
+{
+    chip8core::Chip8Runner runner(37, 3);
+    EXPECT_EQ(runner.size(), 37u);
+    EXPECT_EQ(runner.getThreadCount(), 3u);
+
+    runner.loadROM(kGlyphRom.data(), kGlyphRom.size());
+    runner.runFrames(2, 10);
+
+    const auto& results = runner.getResults();
+    ASSERT_EQ(results.size(), 37u);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        EXPECT_NE(results[i].framebuffer[0], 0u) << "Machine " << i << " should have drawn";
+        EXPECT_TRUE(results[i].soundOn);
+        EXPECT_EQ(results[i].exitReason, chip8core::Chip8ExitReason::Halted);
+        EXPECT_EQ(runner.getMachine(i).getCPU().getPC(), 0x20C);
+    }
+}
+
+// Test that results are reproducible for the same seed regardless of thread count.
+TEST(Chip8RunnerTest, DeterministicAcrossThreadCounts)
+{
+    chip8core::Chip8Runner single(20, 1);
+    chip8core::Chip8Runner multi(20, 4);
+    single.reset(42);
+    multi.reset(42);
+    single.loadROM(kGlyphRom.data(), kGlyphRom.size());
+    multi.loadROM(kGlyphRom.data(), kGlyphRom.size());
+    single.runFrames(3, 10);
+    multi.runFrames(3, 10);
+
+    for (size_t i = 0; i < single.size(); ++i)
+    {
+        for (int row = 0; row < chip8core::Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT; ++row)
+        {
+            EXPECT_EQ(single.getResults()[i].framebuffer[row],
+                      multi.getResults()[i].framebuffer[row]);
+        }
+    }
+}
+
+// Test that a machine raising an exception is reported as faulted.
+TEST(Chip8RunnerTest, ReportsFaults)
+{
+    const std::vector<uint8_t> rom = {
+        0xAF, 0xFF, // I = 0xFFF
+        0xF1, 0x55, // store V0..V1 past the end of memory
+    };
+    chip8core::Chip8Runner runner(2, 2);
+    runner.loadROM(rom.data(), rom.size());
+    runner.runFrames(1, 10);
+
+    for (const auto& result : runner.getResults())
+    {
+        EXPECT_EQ(result.exitReason, chip8core::Chip8ExitReason::Fault);
+    }
+}
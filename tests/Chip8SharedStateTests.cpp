@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "Chip8Core/Chip8SharedState.h"
+
+// Test that a published frame reads back whole, low word first in the shared words.
+TEST(Chip8SharedStateTest, FrameRoundTrip)
+{
+    chip8core::Chip8SharedState    shared;
+    chip8core::Chip8GraphicsBuffer graphics;
+    graphics.setPixel(0, 0, true);
+    graphics.setPixel(63, 31, true);
+    shared.publishFrame(graphics);
+
+    uint64_t rows[chip8core::Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT];
+    ASSERT_TRUE(shared.readFrame(rows));
+    EXPECT_EQ(chip8core::Chip8GraphicsBuffer::hashRows(rows), graphics.getHash());
+    EXPECT_EQ(shared.getFrameCount(), 1u);
+
+    const std::atomic<uint32_t>* words = shared.data();
+    EXPECT_EQ(words[chip8core::Chip8SharedState::FRAME].load(), 0u);
+    EXPECT_EQ(words[chip8core::Chip8SharedState::FRAME + 1].load(), 0x80000000u); // Pixel 0
+    EXPECT_EQ(words[chip8core::Chip8SharedState::FRAME + 62].load(), 1u);         // Pixel 63
+
+    shared.setKeyMask(0x8001);
+    EXPECT_EQ(words[chip8core::Chip8SharedState::KEY_MASK].load(), 0x8001u);
+}
+
+// Test that edges keep every field and a reader that falls a ring behind skips ahead.
+TEST(Chip8SharedStateTest, EdgeRing)
+{
+    chip8core::Chip8SharedState shared;
+    chip8core::Chip8SoundEdge   edge{0x123456789ull, true, 112, true, {}};
+    for (int i = 0; i < 16; ++i)
+    {
+        edge.pattern[i] = static_cast<uint8_t>(0xF0 + i);
+    }
+    shared.publishEdge(edge);
+
+    uint32_t                  next = 0;
+    chip8core::Chip8SoundEdge read{};
+    ASSERT_TRUE(shared.readEdge(next, read));
+    EXPECT_EQ(read.cycle, edge.cycle);
+    EXPECT_TRUE(read.on);
+    EXPECT_EQ(read.pitch, 112);
+    EXPECT_TRUE(read.hasPattern);
+    EXPECT_EQ(read.pattern[15], 0xFF);
+    EXPECT_FALSE(shared.readEdge(next, read));
+
+    for (uint64_t cycle = 1; cycle <= 100; ++cycle)
+    {
+        shared.publishEdge({cycle, cycle % 2 == 1, 64, false, {}});
+    }
+    ASSERT_TRUE(shared.readEdge(next, read));
+    EXPECT_EQ(read.cycle, 101u - chip8core::Chip8SharedState::EDGE_CAPACITY + 1);
+    EXPECT_EQ(next, 101u - chip8core::Chip8SharedState::EDGE_CAPACITY + 2);
+}
+
+// Test that frames read while another thread publishes are never torn.
+TEST(Chip8SharedStateTest, FramesAcrossThreads)
+{
+    constexpr int FRAMES = 20000;
+
+    chip8core::Chip8SharedState shared;
+    std::thread                 producer(
+        [&shared]()
+        {
+            chip8core::Chip8GraphicsBuffer graphics;
+            for (int frame = 1; frame <= FRAMES; ++frame)
+            {
+                graphics.clear();
+                for (int y = 0; y < chip8core::Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT; ++y)
+                {
+                    graphics.drawSpriteRow(0, y, static_cast<uint8_t>(frame));
+                    graphics.drawSpriteRow(56, y, static_cast<uint8_t>(frame >> 8));
+                }
+                shared.publishFrame(graphics);
+            }
+        });
+
+    uint64_t rows[chip8core::Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT];
+    int      reads = 0;
+    while (shared.getFrameCount() < static_cast<uint32_t>(FRAMES))
+    {
+        if (!shared.readFrame(rows))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        for (uint64_t row : rows)
+        {
+            ASSERT_EQ(row, rows[0]) << "Torn frame";
+        }
+        ++reads;
+    }
+    producer.join();
+    EXPECT_GT(reads, 0);
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8SoundRenderer.h"
+
+namespace
+{
+constexpr int SAMPLE_RATE = 44100;
+
+// 0x200 LD V0, 6; 0x202 LD ST, V0; 0x204 JP 0x204
+const uint8_t BEEP_SIX_TICKS[] = {0x60, 0x06, 0xF0, 0x18, 0x12, 0x04};
+
+// 0x200 LD I, 0x20C; 0x202 AUDIO; 0x204 LD V0, 112; 0x206 PITCH V0; 0x208 LD ST, V0;
+// 0x20A JP 0x20A; 0x20C pattern of eight high bits then eight low bits, eight times
+const uint8_t XO_CHIP_TONE[] = {0xA2, 0x0C, 0xF0, 0x02, 0x60, 0x70, 0xF0, 0x3A, 0xF0, 0x18,
+                                0x12, 0x0A, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+                                0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00};
+
+int countRises(const std::vector<uint8_t>& samples)
+{
+    int rises = 0;
+    for (size_t i = 1; i < samples.size(); ++i)
+    {
+        rises += samples[i] > samples[i - 1];
+    }
+    return rises;
+}
+
+size_t countTone(const std::vector<uint8_t>& samples)
+{
+    return std::count_if(samples.begin(), samples.end(), [](uint8_t sample)
+                         { return sample != chip8core::Chip8SoundRenderer::SILENCE; });
+}
+} // namespace
+
+// Test that the tone starts and stops on the samples matching the edge cycles.
+TEST(Chip8SoundRendererTest, BeepLengthIsSampleAccurate)
+{
+    chip8core::Chip8SoundRenderer renderer(SAMPLE_RATE);
+    renderer.getQueue().push({700, true, 0, false, {}});
+    renderer.getQueue().push({770, false, 0, false, {}}); // 70 cycles, a tenth of a second
+    renderer.setEmulatedCycle(700 + chip8core::Chip8SoundRenderer::LATENCY_CYCLES);
+
+    std::vector<uint8_t> samples(SAMPLE_RATE);
+    renderer.render(samples.data(), samples.size());
+
+    EXPECT_EQ(countTone(samples), SAMPLE_RATE / 10u);
+    EXPECT_NE(samples[0], chip8core::Chip8SoundRenderer::SILENCE);
+    EXPECT_EQ(samples[SAMPLE_RATE / 10], chip8core::Chip8SoundRenderer::SILENCE);
+    EXPECT_TRUE(renderer.getQueue().empty());
+}
+
+// Test that the wavetable plays a 440Hz square wave across block boundaries.
+TEST(Chip8SoundRendererTest, TonePitchAcrossBlocks)
+{
+    constexpr uint64_t            LATENCY = chip8core::Chip8SoundRenderer::LATENCY_CYCLES;
+    chip8core::Chip8SoundRenderer renderer(SAMPLE_RATE);
+    renderer.getQueue().push({0, true, 0, false, {}});
+
+    std::vector<uint8_t> samples(SAMPLE_RATE);
+    for (size_t offset = 0; offset < samples.size(); offset += 512)
+    {
+        renderer.setEmulatedCycle(LATENCY + offset * chip8core::Chip8::CPU_HZ / SAMPLE_RATE);
+        renderer.render(samples.data() + offset, std::min<size_t>(512, samples.size() - offset));
+    }
+
+    EXPECT_NEAR(countRises(samples), chip8core::Chip8SoundRenderer::TONE_HZ, 1);
+    EXPECT_EQ(countTone(samples), samples.size());
+    EXPECT_EQ(renderer.getResyncCount(), 0u);
+}
+
+// Test that playback jumps back in line when the emulation runs far ahead.
+TEST(Chip8SoundRendererTest, ResyncsAfterStall)
+{
+    chip8core::Chip8SoundRenderer renderer(SAMPLE_RATE);
+    std::vector<uint8_t>          samples(512);
+
+    renderer.setEmulatedCycle(7000);
+    renderer.render(samples.data(), samples.size());
+    EXPECT_EQ(renderer.getResyncCount(), 1u);
+    EXPECT_EQ(countTone(samples), 0u);
+}
+
+// Test that the machine stamps sound edges with the cycles the timer starts and stops at.
+TEST(Chip8SoundRendererTest, MachineEdgesFollowSoundTimer)
+{
+    chip8core::Chip8           machine;
+    chip8core::Chip8SoundQueue queue;
+    machine.attachSoundQueue(&queue);
+    machine.loadROM(BEEP_SIX_TICKS, sizeof(BEEP_SIX_TICKS));
+    machine.runCycles(chip8core::Chip8::CPU_HZ);
+
+    // Attaching sends the current, silent state
+    chip8core::Chip8SoundEdge edge;
+    ASSERT_TRUE(queue.peek(edge));
+    EXPECT_FALSE(edge.on);
+    EXPECT_EQ(edge.cycle, 0u);
+    queue.pop();
+
+    ASSERT_TRUE(queue.peek(edge));
+    EXPECT_TRUE(edge.on);
+    EXPECT_EQ(edge.cycle, 2u);
+    EXPECT_FALSE(edge.hasPattern);
+    queue.pop();
+
+    // Six 60Hz ticks later, counted from the start of the emulated clock
+    ASSERT_TRUE(queue.peek(edge));
+    EXPECT_FALSE(edge.on);
+    EXPECT_EQ(edge.cycle, 6u * chip8core::Chip8::CPU_HZ / chip8core::Chip8::TIMER_HZ);
+    queue.pop();
+    EXPECT_TRUE(queue.empty());
+}
+
+// Test that rate control absorbs a host clock running 0.3% fast without any jump.
+TEST(Chip8SoundRendererTest, RateControlAbsorbsClockDrift)
+{
+    chip8core::Chip8SoundRenderer renderer(SAMPLE_RATE);
+    std::vector<uint8_t>          block(512);
+
+    double emulated = chip8core::Chip8SoundRenderer::LATENCY_CYCLES;
+    for (int i = 0; i < 60 * SAMPLE_RATE / 512; ++i) // An emulated minute
+    {
+        emulated += 512.0 * chip8core::Chip8::CPU_HZ / SAMPLE_RATE * 1.003;
+        renderer.setEmulatedCycle(static_cast<uint64_t>(emulated));
+        renderer.render(block.data(), block.size());
+    }
+    EXPECT_EQ(renderer.getResyncCount(), 0u);
+    EXPECT_GT(renderer.getRateAdjust(), 0);
+    EXPECT_LE(renderer.getRateAdjust(), chip8core::Chip8SoundRenderer::MAX_RATE_ADJUST);
+}
+
+// Test that a machine paced by the audio clock runs one emulated second per second of audio.
+TEST(Chip8SoundRendererTest, AudioClockPacesMachine)
+{
+    chip8core::Chip8              machine;
+    chip8core::Chip8SoundRenderer renderer(SAMPLE_RATE);
+    machine.attachSoundQueue(&renderer.getQueue());
+    machine.loadROM(BEEP_SIX_TICKS, sizeof(BEEP_SIX_TICKS));
+
+    std::vector<uint8_t> samples(SAMPLE_RATE);
+    for (size_t offset = 0; offset < samples.size(); offset += 128) // Small device blocks
+    {
+        machine.cycleUntil(renderer.getTargetCycle());
+        renderer.setEmulatedCycle(machine.getCycleCount());
+        renderer.render(samples.data() + offset, std::min<size_t>(128, samples.size() - offset));
+    }
+
+    EXPECT_NEAR(static_cast<double>(machine.getCycleCount()),
+                chip8core::Chip8::CPU_HZ + chip8core::Chip8SoundRenderer::LATENCY_CYCLES, 2);
+    EXPECT_EQ(renderer.getResyncCount(), 0u);
+    EXPECT_EQ(renderer.getRateAdjust(), 0);
+    // The six-tick beep, from cycle 2 to the sixth timer tick at cycle 70
+    EXPECT_EQ(countTone(samples), 68u * SAMPLE_RATE / chip8core::Chip8::CPU_HZ);
+}
+
+// Test that an XO-CHIP pattern loops at the rate set by the pitch register.
+TEST(Chip8SoundRendererTest, XoChipPatternAndPitch)
+{
+    chip8core::Chip8              machine;
+    chip8core::Chip8SoundRenderer renderer(SAMPLE_RATE);
+    machine.attachSoundQueue(&renderer.getQueue());
+    machine.loadROM(XO_CHIP_TONE, sizeof(XO_CHIP_TONE));
+
+    // Pitch 112 is one octave up: 8000 bits per second, 16 bits per square period
+    std::vector<uint8_t> samples(SAMPLE_RATE);
+    for (size_t offset = 0; offset < samples.size(); offset += 512)
+    {
+        machine.cycleUntil(renderer.getTargetCycle());
+        renderer.setEmulatedCycle(machine.getCycleCount());
+        renderer.render(samples.data() + offset, std::min<size_t>(512, samples.size() - offset));
+    }
+
+    // The tone lasts 112 ticks, from cycle 5 to about 1.87 emulated seconds
+    EXPECT_EQ(countTone(samples), samples.size() - 5 * SAMPLE_RATE / chip8core::Chip8::CPU_HZ);
+    EXPECT_NEAR(countRises(samples), 500 - 500 * 5 / chip8core::Chip8::CPU_HZ, 2); // 500Hz
+}
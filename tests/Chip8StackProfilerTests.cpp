@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8StackProfiler.h"
+
+namespace
+{
+// 0x200: CALL outer, then spin; outer calls inner, which spins forever
+const std::vector<uint8_t> kNestedRom = {
+    0x22, 0x06, // 0x200: CALL 0x206
+    0x12, 0x02, // 0x202: JP 0x202
+    0x00, 0x00, // 0x204: padding
+    0x22, 0x0A, // 0x206: CALL 0x20A
+    0x00, 0xEE, // 0x208: RET
+    0x12, 0x0A, // 0x20A: JP 0x20A
+};
+
+chip8core::Chip8StackProfiler runNested(chip8core::Chip8& chip8, int instructions)
+{
+    chip8.reset();
+    chip8.loadROM(kNestedRom.data(), kNestedRom.size());
+    chip8core::Chip8StackProfiler profiler(1);
+    for (int i = 0; i < instructions; ++i)
+    {
+        chip8.step();
+        profiler.onInstruction(chip8);
+    }
+    return profiler;
+}
+} // namespace
+
+// Test that sampled stacks name the called subroutines, outermost first.
+TEST(Chip8StackProfilerTest, SamplesCallStack)
+{
+    chip8core::Chip8 chip8;
+    auto             profiler = runNested(chip8, 5);
+
+    EXPECT_EQ(profiler.getSampleCount(), 5u);
+    const auto& stacks = profiler.getStacks();
+    ASSERT_EQ(stacks.size(), 2u);
+    EXPECT_EQ(stacks.at({0x206, 0x206}), 1u);
+    EXPECT_EQ(stacks.at({0x206, 0x20A, 0x20A}), 4u);
+}
+
+// Test that folded output is symbolized and merges frames inside the same label.
+TEST(Chip8StackProfilerTest, WritesFoldedStacks)
+{
+    chip8core::Chip8 chip8;
+    auto             profiler = runNested(chip8, 5);
+
+    std::ostringstream raw;
+    profiler.writeFolded(raw);
+    EXPECT_EQ(raw.str(), "0x206;0x206 1\n0x206;0x20A;0x20A 4\n");
+
+    chip8core::Chip8Symbols symbols;
+    symbols.add(0x200, "main");
+    symbols.add(0x206, "outer");
+    symbols.add(0x20A, "inner");
+    std::ostringstream folded;
+    profiler.writeFolded(folded, &symbols);
+    EXPECT_EQ(folded.str(), "outer 1\nouter;inner 4\n");
+}
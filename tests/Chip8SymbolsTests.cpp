@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+#include "Chip8Core/Chip8Symbols.h"
+
+// Test that symbol maps are read in either column order and comments are ignored.
+TEST(Chip8SymbolsTest, LoadMap)
+{
+    std::istringstream map("0x200 main\n"
+                           "# comment line\n"
+                           "draw 0x2A0 # trailing comment\n"
+                           "not-a-symbol\n");
+    chip8core::Chip8Symbols symbols;
+    symbols.loadMap(map);
+
+    EXPECT_EQ(symbols.size(), 2u);
+    uint16_t address = 0;
+    ASSERT_TRUE(symbols.find("draw", address));
+    EXPECT_EQ(address, 0x2A0);
+    EXPECT_EQ(symbols.symbolize(0x200), "main");
+    EXPECT_EQ(symbols.symbolize(0x29E), "main");
+    EXPECT_EQ(symbols.symbolize(0x2A4), "draw");
+    EXPECT_EQ(symbols.symbolize(0x100), "0x100");
+}
+
+// Test that Octo statements, macros and string modes are sized like the assembler does.
+TEST(Chip8SymbolsTest, LoadOctoSizesStatements)
+{
+    std::istringstream source(": main\n"
+                              "  clear                  # 0x200\n"
+                              "  v0 := random 0xFF      # 0x202\n"
+                              "  i := long data         # 0x204, 4 bytes\n"
+                              "  loop\n"
+                              "    if v0 < v1 then v0 += 1 # 0x208, 6 + 2 bytes\n"
+                              "    draw                 # 0x210, a call\n"
+                              "  again                  # 0x212\n"
+                              ":macro twice X { X X }\n"
+                              ":stringmode text \"AB\" { :byte { VALUE + 1 } }\n"
+                              ": draw\n"
+                              "  twice return           # 0x214\n"
+                              ": data\n"
+                              "  1 2 3 text \"ABBA\"    # 0x218\n"
+                              ":org 0x300\n"
+                              ": far\n"
+                              "  :unpack 0xA data\n");
+    chip8core::Chip8Symbols symbols;
+    EXPECT_EQ(symbols.loadOcto(source), 0x304);
+
+    uint16_t address = 0;
+    ASSERT_TRUE(symbols.find("main", address));
+    EXPECT_EQ(address, 0x200);
+    ASSERT_TRUE(symbols.find("draw", address));
+    EXPECT_EQ(address, 0x214);
+    ASSERT_TRUE(symbols.find("data", address));
+    EXPECT_EQ(address, 0x218);
+    ASSERT_TRUE(symbols.find("far", address));
+    EXPECT_EQ(address, 0x300);
+    EXPECT_EQ(symbols.symbolize(0x21E), "data");
+}
+
+// Test that a program whose main is not first keeps the reserved jump at 0x200.
+TEST(Chip8SymbolsTest, LoadOctoReservesJumpToMain)
+{
+    std::istringstream source(": helper\n"
+                              "  return\n"
+                              ": main\n"
+                              "  helper\n");
+    chip8core::Chip8Symbols symbols;
+    EXPECT_EQ(symbols.loadOcto(source), 0x206);
+
+    uint16_t address = 0;
+    ASSERT_TRUE(symbols.find("helper", address));
+    EXPECT_EQ(address, 0x202);
+    ASSERT_TRUE(symbols.find("main", address));
+    EXPECT_EQ(address, 0x204);
+}
+
+// Test that sizing each bundled Octo source reproduces its assembled ROM and main address.
+TEST(Chip8SymbolsTest, LoadOctoMatchesBundledROMs)
+{
+    int checked = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(CHIP8_ROM_DIR))
+    {
+        std::filesystem::path path = entry.path();
+        if (path.extension() != ".8o")
+        {
+            continue;
+        }
+        SCOPED_TRACE(path.filename().string());
+
+        std::ifstream file(std::filesystem::path(path).replace_extension(".ch8"),
+                           std::ios::binary);
+        ASSERT_TRUE(file);
+        std::vector<uint8_t> rom((std::istreambuf_iterator<char>(file)),
+                                 std::istreambuf_iterator<char>());
+        ASSERT_GE(rom.size(), 2u);
+
+        std::ifstream           source(path);
+        chip8core::Chip8Symbols symbols;
+        EXPECT_EQ(symbols.loadOcto(source), 0x200 + rom.size());
+
+        // main is either first or the target of the jump Octo reserves at 0x200
+        uint16_t main = 0;
+        ASSERT_TRUE(symbols.find("main", main));
+        if (main != 0x200)
+        {
+            EXPECT_EQ((rom[0] << 8) | rom[1], 0x1000 | main);
+        }
+        ++checked;
+    }
+    EXPECT_GT(checked, 0);
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include "Chip8Core/Chip8.h"
+#include "Chip8Core/Chip8LatencyTracker.h"
+
+// Guard the per-instance footprint so many machines fit in cache-friendly memory.
+TEST(Chip8Test, InstanceFootprint)
+{
+    EXPECT_LT(sizeof(chip8core::Chip8), 5 * 1024);
+    // Packed rows plus the maintained frame hash
+    EXPECT_EQ(sizeof(chip8core::Chip8GraphicsBuffer),
+              (chip8core::Chip8GraphicsBuffer::FRAMEBUFFER_HEIGHT + 1) * sizeof(uint64_t));
+    EXPECT_EQ(alignof(chip8core::Chip8CPU), 64u);
+}
+
+// Test that the font is loaded into memory for every instance.
+TEST(Chip8Test, FontSharedAcrossInstances)
+{
+    chip8core::Chip8 first;
+    chip8core::Chip8 second;
+    for (size_t i = 0; i < chip8core::Chip8CPU::FONT_BYTES; ++i)
+    {
+        EXPECT_EQ(first.getCPU().getFont(i), second.getCPU().getFont(i));
+    }
+}
+
+// Test that stepping counts emulated instructions and reset clears the counters.
+TEST(Chip8Test, StatsCountInstructions)
+{
+    chip8core::Chip8 chip8;
+    const uint8_t    rom[] = {0x12, 0x00}; // JP 0x200
+    chip8.loadROM(rom, sizeof(rom));
+    chip8.runFrame(10);
+    chip8.runFrame(10);
+    EXPECT_EQ(chip8.getStats().instructions, 20u);
+
+    chip8.getStats().recordFrame(16000000, true);
+    chip8.getStats().recordFrame(1000000, false);
+    EXPECT_EQ(chip8.getStats().framesRendered, 1u);
+    EXPECT_EQ(chip8.getStats().framesSkipped, 1u);
+
+    chip8.getStats().reset();
+    EXPECT_EQ(chip8.getStats().instructions, 0u);
+    EXPECT_EQ(chip8.getStats().frameTime.getCount(), 0u);
+}
+
+// Test that percentiles come from the bucket holding the requested rank.
+TEST(Chip8Test, HistogramPercentiles)
+{
+    chip8core::Chip8Histogram histogram(10, 4);
+    for (int i = 0; i < 98; ++i)
+    {
+        histogram.record(5);
+    }
+    histogram.record(25);
+    histogram.record(500);
+
+    EXPECT_EQ(histogram.getCount(), 100u);
+    EXPECT_EQ(histogram.percentile(0.5), 10u);
+    EXPECT_EQ(histogram.percentile(0.99), 30u);
+    EXPECT_EQ(histogram.percentile(1.0), 500u);
+    EXPECT_EQ(histogram.getBuckets().back(), 1u);
+}
+
+// Test that latency runs from the oldest key transition to the first changed frame.
+TEST(Chip8Test, LatencyTrackerMeasuresFirstChange)
+{
+    chip8core::Chip8GraphicsBuffer graphics;
+    chip8core::Chip8LatencyTracker latency;
+    latency.onFrame(graphics, 0);
+
+    latency.onKeyTransition(1000000);
+    latency.onKeyTransition(2000000);
+    latency.onFrame(graphics, 5000000); // Unchanged, still waiting
+    graphics.setPixel(3, 4, true);
+    latency.onFrame(graphics, 9000000);
+
+    EXPECT_EQ(latency.getTransitionCount(), 2u);
+    EXPECT_EQ(latency.getLatency().getCount(), 1u);
+    EXPECT_EQ(latency.getLatency().getMax(), 8000000u);
+
+    // A transition the ROM never answers times out instead of being measured
+    latency.onKeyTransition(10000000);
+    latency.onFrame(graphics, 10000000 + chip8core::Chip8LatencyTracker::TIMEOUT_NS + 1);
+    EXPECT_EQ(latency.getUnansweredCount(), 1u);
+    EXPECT_EQ(latency.getLatency().getCount(), 1u);
+
+    std::ostringstream report;
+    chip8core::Chip8Stats stats;
+    stats.recordPhases(100000, 200000, 300000);
+    stats.dumpText(report, "test.ch8");
+    latency.dumpText(report);
+    EXPECT_NE(report.str().find("Performance of test.ch8"), std::string::npos);
+    EXPECT_NE(report.str().find("Input latency p50 8.00 ms"), std::string::npos);
+}
+
+// Test that the CPU rate changes instructions per frame while the timers keep 60Hz.
+TEST(Chip8Test, CpuRateKeepsTimersAt60Hz)
+{
+    chip8core::Chip8 chip8;
+    const uint8_t    rom[] = {0x60, 0x3C, 0xF0, 0x15, 0x12, 0x04}; // LD V0, 60; LD DT, V0; JP self
+    chip8.setCyclesPerFrame(30);
+    chip8.reset();
+    chip8.loadROM(rom, sizeof(rom));
+    EXPECT_EQ(chip8.getCpuHz(), 1800);
+
+    // A quarter of an emulated second, 175 cycles on the 700Hz clock
+    EXPECT_EQ(chip8.cycleUntil(175), 450);
+    EXPECT_EQ(chip8.getCycleCount(), 450u);
+    EXPECT_EQ(chip8.getEmulatedClock(), 175u);
+    EXPECT_EQ(chip8.getDelayTimer().getValue(), 45);
+
+    // Slowing down mid-frame keeps the clock where it was
+    chip8.setCpuHz(chip8core::Chip8::CPU_HZ);
+    EXPECT_EQ(chip8.getEmulatedClock(), 175u);
+    EXPECT_EQ(chip8.cycleUntil(350), 175);
+    EXPECT_EQ(chip8.getDelayTimer().getValue(), 30);
+}
+
+// Test that turbo scales wall time and unlimited speed runs whole frames.
+TEST(Chip8Test, TurboAndUnlimitedSpeed)
+{
+    chip8core::Chip8 chip8;
+    const uint8_t    rom[] = {0x12, 0x00}; // JP 0x200
+    chip8.loadROM(rom, sizeof(rom));
+
+    chip8.setSpeed(4.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50)); // 140 cycles owed at 4x
+    EXPECT_GE(chip8.cycle(), 140);
+    EXPECT_EQ(chip8.getStats().cyclesDropped, 0u);
+
+    chip8.setSpeed(chip8core::Chip8::UNLIMITED);
+    uint64_t clock    = chip8.getEmulatedClock();
+    int      executed = chip8.cycle();
+    EXPECT_GT(executed, 4 * chip8core::Chip8::CATCH_UP_BUDGET);
+    EXPECT_EQ(executed % 12, 0); // Frames of 700 / 60 cycles, rounded up
+    EXPECT_GE(chip8.getEmulatedClock() - clock, static_cast<uint64_t>(executed) - 1);
+}
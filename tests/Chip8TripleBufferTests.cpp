@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+
+#include "Chip8Core/Chip8TripleBuffer.h"
+
+// Test that the consumer gets the latest published value once, and nothing in between.
+TEST(Chip8TripleBufferTest, LatestValueWins)
+{
+    chip8core::Chip8TripleBuffer<int> buffer;
+    EXPECT_EQ(buffer.acquire(), nullptr);
+
+    buffer.back() = 1;
+    buffer.publish();
+    buffer.back() = 2;
+    buffer.publish();
+
+    const int* value = buffer.acquire();
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 2);
+    EXPECT_EQ(buffer.acquire(), nullptr);
+    EXPECT_EQ(buffer.front(), 2);
+
+    // The consumer's slot is never handed to the producer
+    buffer.back() = 3;
+    buffer.publish();
+    buffer.back() = 4;
+    EXPECT_EQ(buffer.front(), 2);
+    EXPECT_EQ(*buffer.acquire(), 3);
+}
+
+// Test that frames crossing threads arrive whole and in order, ending with the last one.
+TEST(Chip8TripleBufferTest, FramesAcrossThreads)
+{
+    constexpr uint64_t FRAMES = 20000;
+    using Frame               = std::array<uint64_t, 32>; // Every row holds the frame number
+
+    chip8core::Chip8TripleBuffer<Frame> frames;
+    std::thread                         producer(
+        [&frames]()
+        {
+            for (uint64_t frame = 1; frame <= FRAMES; ++frame)
+            {
+                frames.back().fill(frame);
+                frames.publish();
+            }
+        });
+
+    uint64_t last = 0;
+    while (last < FRAMES)
+    {
+        const Frame* frame = frames.acquire();
+        if (frame == nullptr)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        for (uint64_t row : *frame)
+        {
+            ASSERT_EQ(row, (*frame)[0]) << "Torn frame";
+        }
+        ASSERT_GT((*frame)[0], last) << "Frames went backwards";
+        last = (*frame)[0];
+    }
+    producer.join();
+    EXPECT_EQ(frames.acquire(), nullptr);
+}
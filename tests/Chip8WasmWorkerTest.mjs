@@ -0,0 +1,88 @@
+// Headless check of the Chip8WasmWorker build under Node, where Emscripten runs
+// pthreads on worker_threads and the heap is a SharedArrayBuffer, as in a page.
+// Usage: node Chip8WasmWorkerTest.mjs <Chip8WasmWorker.js> <rom.ch8>
+import assert from 'node:assert/strict';
+import { readFileSync } from 'node:fs';
+import { createRequire } from 'node:module';
+import { setTimeout as sleep } from 'node:timers/promises';
+
+const [modulePath, romPath] = process.argv.slice(2);
+const createChip8Worker = createRequire(import.meta.url)(modulePath);
+const Module = await createChip8Worker({ print: () => {}, printErr: () => {} });
+
+// Views built once over the shared state, see get_shared_layout in main.cpp
+assert.ok(Module.HEAPU8.buffer instanceof SharedArrayBuffer, 'heap is not shared');
+const layout = new Uint32Array(Module.HEAPU32.buffer, Module._get_shared_layout(), 10);
+const [SEQUENCE, KEY_MASK, RUNNING, EDGE_COUNT, CLOCK, FRAME, EDGES, WORDS, CAPACITY, EDGE_WORDS] =
+  layout;
+const words = new Uint32Array(Module.HEAPU32.buffer, Module._get_shared_state(), WORDS);
+
+// The same sequence lock as Chip8SharedState::readFrame()
+function readFrame() {
+  for (;;) {
+    const before = Atomics.load(words, SEQUENCE);
+    const frame = words.slice(FRAME, FRAME + 64);
+    if ((before & 1) === 0 && Atomics.load(words, SEQUENCE) === before) {
+      return frame;
+    }
+  }
+}
+
+// Sound edges by number, as Chip8SharedState::readEdge() lays them out
+function readEdge(n) {
+  const slot = EDGES + (n % CAPACITY) * EDGE_WORDS;
+  return { clock: words[slot], on: words[slot + 2] === 1, pitch: words[slot + 3] };
+}
+
+function startROM(rom) {
+  return Module.ccall('start_rom_bytes', 'number', ['array', 'number'], [rom, rom.length]);
+}
+
+const rom = readFileSync(romPath);
+assert.equal(startROM(rom), 1);
+assert.equal(Atomics.load(words, RUNNING), 1);
+
+// The emulation keeps time while this thread is blocked, as under a busy page
+await sleep(200);
+const clockBefore = Atomics.load(words, CLOCK);
+const blockUntil = performance.now() + 500;
+while (performance.now() < blockUntil) {
+  // Busy main thread
+}
+const advanced = Atomics.load(words, CLOCK) - clockBefore;
+assert.ok(advanced > 700 * 0.4, `emulated clock advanced ${advanced} cycles in 500ms`);
+
+// The ROM has drawn something, and published it whole
+assert.ok(Atomics.load(words, SEQUENCE) >= 2, 'no frame published');
+assert.ok(readFrame().some((word) => word !== 0), 'frame is blank');
+
+// A 12-tick beep (LD V0, 12; LD ST, V0; JP self) publishes an on and an off edge 0.2s apart
+const edgesBefore = Atomics.load(words, EDGE_COUNT);
+assert.equal(startROM(new Uint8Array([0x60, 0x0C, 0xF0, 0x18, 0x12, 0x04])), 1);
+await sleep(500);
+const edges = [];
+for (let n = edgesBefore; n !== Atomics.load(words, EDGE_COUNT); ++n) {
+  edges.push(readEdge(n));
+}
+const beep = edges.findIndex((edge) => edge.on);
+assert.ok(beep >= 0 && beep + 1 < edges.length, `edges ${JSON.stringify(edges)}`);
+assert.equal(edges[beep + 1].on, false);
+const beepCycles = edges[beep + 1].clock - edges[beep].clock;
+assert.ok(Math.abs(beepCycles - 140) <= 12, `beep lasted ${beepCycles} cycles`);
+
+// Keys go the other way: this ROM waits for a key, then draws its digit (LD V0, K; LD F, V0;
+// DRW V0, V0, 5; JP self), so the frame stays blank until key 5 is pressed and released
+assert.equal(startROM(new Uint8Array([0xF0, 0x0A, 0xF0, 0x29, 0xD0, 0x05, 0x12, 0x06])), 1);
+await sleep(200);
+assert.ok(readFrame().every((word) => word === 0), 'drew before a key was pressed');
+Atomics.store(words, KEY_MASK, 1 << 5);
+await sleep(100);
+Atomics.store(words, KEY_MASK, 0);
+await sleep(200);
+const frame = readFrame();
+assert.equal(frame[2 * 5 + 1], 0xF0000000 >>> 5, 'top row of digit 5 not at (5, 5)');
+
+Module._stop();
+assert.equal(Atomics.load(words, RUNNING), 0);
+console.log(`Chip8WasmWorker OK: ${advanced} cycles while blocked, ${beepCycles} cycle beep`);
+process.exit(0);